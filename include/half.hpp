@@ -110,6 +110,9 @@
 		#ifndef HALF_ENABLE_CPP11_HASH
 			#define HALF_ENABLE_CPP11_HASH 1
 		#endif
+		#ifndef HALF_ENABLE_CPP11_THREAD
+			#define HALF_ENABLE_CPP11_THREAD 1
+		#endif
 	#endif
 #elif defined(__GLIBCXX__)									//libstdc++
 	#if defined(__GXX_EXPERIMENTAL_CXX0X__) || __cplusplus >= 201103
@@ -126,6 +129,9 @@
 			#if __GLIBCXX__ >= 20080606 && !defined(HALF_ENABLE_CPP11_HASH)
 				#define HALF_ENABLE_CPP11_HASH 1
 			#endif
+			#if __GLIBCXX__ >= 20120322 && defined(_GLIBCXX_HAS_GTHREADS) && !defined(HALF_ENABLE_CPP11_THREAD)
+				#define HALF_ENABLE_CPP11_THREAD 1
+			#endif
 		#else
 			#if HALF_GNUC_VERSION >= 403 && !defined(HALF_ENABLE_CPP11_CSTDINT)
 				#define HALF_ENABLE_CPP11_CSTDINT 1
@@ -136,6 +142,9 @@
 			#if HALF_GNUC_VERSION >= 403 && !defined(HALF_ENABLE_CPP11_HASH)
 				#define HALF_ENABLE_CPP11_HASH 1
 			#endif
+			#if HALF_GNUC_VERSION >= 407 && defined(_GLIBCXX_HAS_GTHREADS) && !defined(HALF_ENABLE_CPP11_THREAD)
+				#define HALF_ENABLE_CPP11_THREAD 1
+			#endif
 		#endif
 	#endif
 #elif defined(_CPPLIB_VER)									//Dinkumware/Visual C++
@@ -150,12 +159,44 @@
 			#define HALF_ENABLE_CPP11_HASH 1
 		#endif
 	#endif
+	#if _CPPLIB_VER >= 540
+		#ifndef HALF_ENABLE_CPP11_THREAD
+			#define HALF_ENABLE_CPP11_THREAD 1
+		#endif
+	#endif
 	#if _CPPLIB_VER >= 610
 		#ifndef HALF_ENABLE_CPP11_CMATH
 			#define HALF_ENABLE_CPP11_CMATH 1
 		#endif
 	#endif
 #endif
+
+//check SIMD instruction set features
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(HALF_ENABLE_SSE2_INTRINSICS)
+		#define HALF_ENABLE_SSE2_INTRINSICS 1
+	#endif
+	#if HALF_ENABLE_SSE2_INTRINSICS && !defined(HALF_ENABLE_F16C_INTRINSICS)
+		#if defined(__clang__)
+			#if __clang_major__ > 3 || (__clang_major__ == 3 && __clang_minor__ >= 8)
+				#define HALF_ENABLE_F16C_INTRINSICS 1
+			#endif
+		#elif defined(__GNUC__)
+			#if HALF_GNUC_VERSION >= 409
+				#define HALF_ENABLE_F16C_INTRINSICS 1
+			#endif
+		#elif defined(_MSC_VER)
+			#if _MSC_VER >= 1700
+				#define HALF_ENABLE_F16C_INTRINSICS 1
+			#endif
+		#endif
+	#endif
+#endif
+
+//check native half-precision type
+#if (defined(__STDCPP_FLOAT16_T__) || defined(__FLT16_MANT_DIG__)) && !defined(HALF_ENABLE_FLOAT16)
+	#define HALF_ENABLE_FLOAT16 1
+#endif
 #undef HALF_GNUC_VERSION
 
 //support constexpr
@@ -176,6 +217,13 @@
 	#define HALF_NOTHROW	throw()
 #endif
 
+//support target-specific code
+#if HALF_ENABLE_F16C_INTRINSICS && !defined(_MSC_VER)
+	#define HALF_TARGET(isa)	__attribute__((target(isa)))
+#else
+	#define HALF_TARGET(isa)
+#endif
+
 #include <algorithm>
 #include <iostream>
 #include <limits>
@@ -183,15 +231,38 @@
 #include <cmath>
 #include <cstring>
 #include <cstdlib>
+#include <cstddef>
 #if HALF_ENABLE_CPP11_TYPE_TRAITS
 	#include <type_traits>
 #endif
 #if HALF_ENABLE_CPP11_CSTDINT
 	#include <cstdint>
 #endif
-#if HALF_ENABLE_CPP11_HASH
+#if HALF_ENABLE_CPP11_HASH || HALF_ENABLE_CPP11_THREAD
 	#include <functional>
 #endif
+#include <vector>
+#if HALF_ENABLE_CPP11_THREAD
+	#include <memory>
+	#include <atomic>
+	#include <thread>
+	#include <mutex>
+	#include <condition_variable>
+#endif
+#if HALF_ENABLE_SSE2_INTRINSICS
+	#include <emmintrin.h>
+#endif
+#if HALF_ENABLE_FLOAT16 && defined(__STDCPP_FLOAT16_T__)
+	#include <stdfloat>
+#endif
+#if HALF_ENABLE_F16C_INTRINSICS
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#endif
 
 
 /// Default rounding mode.
@@ -223,6 +294,51 @@
 	#define HALF_ROUND_TIES_TO_EVEN	0		// ties away from zero
 #endif
 
+/// Conversion strategy.
+/// This specifies how single conversions between half-precision and single-precision are computed. It can be redefined 
+/// (before including half.hpp) to one of the following values, all of which compute exactly the same results:
+///
+/// value | strategy
+/// ------|--------------------------------------------------------------------------------------------------------------
+/// 0     | split tables of about 10 KiB in total for both directions (default)
+/// 1     | a single table of 256 KiB for conversions to single-precision, one load per conversion
+/// 2     | no tables at all, computing conversions in both directions with integer arithmetic
+/// 3     | the compiler's native half-precision type (see half_float::native_half), falling back to `0` if unavailable
+///
+/// The single table is generated at compile-time if `constexpr` is supported and at the first conversion otherwise. 
+/// Conversions from single-precision to half-precision use the split tables for both `0` and `1`. The bulk conversions 
+/// using SIMD instructions never use any tables.
+///
+/// The native type only rounds to nearest with ties to even and may quiet signaling NaNs, so for `3` conversions use it 
+/// only for this rounding mode and non-NaN values and the split tables otherwise. If it is also the default rounding 
+/// mode, the arithmetic assignment operators with half-precision operands compute directly in the native type, which is 
+/// exact since single-precision arithmetic on half-precision operands is correctly rounded to half-precision anyway. The 
+/// binary arithmetic operators and the mathematical functions still compute in single-precision, since they return 
+/// unrounded expressions that are only rounded when converted to half, which rounding each operation in the native type 
+/// would change. Depending on the target, the compiler implements the native type with hardware instructions (e.g. F16C 
+/// or AVX512-FP16 on x86) or emulates it in software.
+#ifndef HALF_CONVERSION_STRATEGY
+	#define HALF_CONVERSION_STRATEGY	0		// split tables
+#endif
+
+//use native half-precision type
+#if HALF_CONVERSION_STRATEGY == 3 && HALF_ENABLE_FLOAT16
+	#define HALF_NATIVE_CONVERSION	1
+	#if HALF_ROUND_STYLE == 1 && HALF_ROUND_TIES_TO_EVEN
+		#define HALF_NATIVE_ARITHMETIC	1
+	#endif
+#endif
+
+/// Default threshold for streaming bulk conversions.
+/// Bulk conversions writing at least this many bytes into the destination array use non-temporal stores, which bypass the 
+/// caches and avoid reading the destination memory before overwriting it, together with software prefetching of the source 
+/// array. This pays off for arrays that don't fit into the last level cache anyway, but only hurts for data accessed again 
+/// soon after the conversion. By default this is set to 16 MiB, but it can be redefined (before including half.hpp) or 
+/// changed at runtime with set_streaming_threshold(). Streaming is only used together with SSE2 instructions.
+#ifndef HALF_STREAMING_THRESHOLD
+	#define HALF_STREAMING_THRESHOLD	16777216	// 16 MiB
+#endif
+
 /// Value signaling overflow.
 /// In correspondence with `HUGE_VAL[F|L]` from `<cmath>` this symbol expands to a positive value signaling the overflow of an 
 /// operation, in particular it just evaluates to positive infinity.
@@ -262,6 +378,19 @@
 namespace half_float
 {
 	class half;
+	class function_table;
+
+#if HALF_ENABLE_FLOAT16
+	/// Native half-precision type of the compiler.
+	/// This is C++23's `std::float16_t` if available and the `_Float16` extension otherwise. It has the same binary 
+	/// representation as [half](\ref half_float::half), so arrays of both can be reinterpreted as each other using 
+	/// native_cast() without copying. It is only defined if `HALF_ENABLE_FLOAT16` is set.
+	#if defined(__STDCPP_FLOAT16_T__)
+		typedef std::float16_t native_half;
+	#else
+		__extension__ typedef _Float16 native_half;
+	#endif
+#endif
 
 #if HALF_ENABLE_CPP11_USER_LITERALS
 	/// Library-defined half-precision literals.
@@ -446,42 +575,69 @@ namespace half_float
 		/// \name Conversion
 		/// \{
 
+	#if HALF_ENABLE_FLOAT16
+		/// Reinterpret half-precision bits as native half-precision value.
+		/// \param value binary representation of half-precision value
+		/// \return native half-precision value
+		inline native_half bits2native(uint16 value)
+		{
+			native_half out;
+			std::memcpy(&out, &value, sizeof(native_half));
+			return out;
+		}
+
+		/// Reinterpret native half-precision value as half-precision bits.
+		/// \param value native half-precision value
+		/// \return binary representation of half-precision value
+		inline uint16 native2bits(native_half value)
+		{
+			uint16 out;
+			std::memcpy(&out, &value, sizeof(uint16));
+			return out;
+		}
+	#endif
+
 		/// Convert IEEE single-precision to half-precision.
 		/// Credit for this goes to [Jeroen van der Zijp](ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf).
 		/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+		/// \tparam E `true` for round to even, `false` for round away from zero
 		/// \param value single-precision value
 		/// \return binary representation of half-precision value
-		template<std::float_round_style R> uint16 float2half_impl(float value, true_type)
+		template<std::float_round_style R,bool E> uint16 float2half_impl(float value, true_type)
 		{
+		#if HALF_NATIVE_CONVERSION
+			if(R == std::round_to_nearest && E && value == value)
+				return native2bits(static_cast<native_half>(value));
+		#endif
 			typedef bits<float>::type uint32;
 			uint32 bits;// = *reinterpret_cast<uint32*>(&value);		//violating strict aliasing!
 			std::memcpy(&bits, &value, sizeof(float));
-/*			uint16 hbits = (bits>>16) & 0x8000;
+		#if HALF_CONVERSION_STRATEGY == 2
+			uint16 hbits = (bits>>16) & 0x8000;
 			bits &= 0x7FFFFFFF;
-			int exp = bits >> 23;
-			if(exp == 255)
-				return hbits | 0x7C00 | (0x3FF&-static_cast<unsigned>((bits&0x7FFFFF)!=0));
-			if(exp > 142)
+			if(bits >= 0x7F800000)
+				return hbits | 0x7C00 | ((bits>>13)&0x3FF);
+			if(bits >= 0x47800000)
 			{
 				if(R == std::round_toward_infinity)
-					return hbits | 0x7C00 - (hbits>>15);
+					return hbits | (0x7C00-(hbits>>15));
 				if(R == std::round_toward_neg_infinity)
-					return hbits | 0x7BFF + (hbits>>15);
-				return hbits | 0x7BFF + (R!=std::round_toward_zero);
+					return hbits | (0x7BFF+(hbits>>15));
+				return hbits | (0x7BFF+(R!=std::round_toward_zero));
 			}
-			int g, s;
-			if(exp > 112)
+			unsigned int g, s;
+			if(bits >= 0x38800000)
 			{
 				g = (bits>>12) & 1;
 				s = (bits&0xFFF) != 0;
-				hbits |= ((exp-112)<<10) | ((bits>>13)&0x3FF);
+				hbits |= (bits>>13) - 0x1C000;
 			}
-			else if(exp > 101)
+			else if(bits >= 0x33000000)
 			{
-				int i = 125 - exp;
+				int i = 125 - static_cast<int>(bits>>23);
 				bits = (bits&0x7FFFFF) | 0x800000;
 				g = (bits>>i) & 1;
-				s = (bits&((1L<<i)-1)) != 0;
+				s = (bits&((static_cast<uint32>(1)<<i)-1)) != 0;
 				hbits |= bits >> (i+1);
 			}
 			else
@@ -490,16 +646,14 @@ namespace half_float
 				s = bits != 0;
 			}
 			if(R == std::round_to_nearest)
-				#if HALF_ROUND_TIES_TO_EVEN
-					hbits += g & (s|hbits);
-				#else
-					hbits += g;
-				#endif
+				hbits += g & (s|hbits|!E);
 			else if(R == std::round_toward_infinity)
 				hbits += ~(hbits>>15) & (s|g);
 			else if(R == std::round_toward_neg_infinity)
 				hbits += (hbits>>15) & (g|s);
-*/			static const uint16 base_table[512] = { 
+			return hbits;
+		#else
+			static const uint16 base_table[512] = { 
 				0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
 				0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
 				0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
@@ -551,11 +705,8 @@ namespace half_float
 				24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 13 };
 			uint16 hbits = base_table[bits>>23] + static_cast<uint16>((bits&0x7FFFFF)>>shift_table[bits>>23]);
 			if(R == std::round_to_nearest)
-				hbits += (((bits&0x7FFFFF)>>(shift_table[bits>>23]-1))|(((bits>>23)&0xFF)==102)) & ((hbits&0x7C00)!=0x7C00)
-				#if HALF_ROUND_TIES_TO_EVEN
-					& (((((static_cast<uint32>(1)<<(shift_table[bits>>23]-1))-1)&bits)!=0)|hbits)
-				#endif
-				;
+				hbits += (((bits&0x7FFFFF)>>(shift_table[bits>>23]-1))|(((bits>>23)&0xFF)==102)) & ((hbits&0x7C00)!=0x7C00) & 
+					(((((static_cast<uint32>(1)<<(shift_table[bits>>23]-1))-1)&bits)!=0)|hbits|!E);
 			else if(R == std::round_toward_zero)
 				hbits -= ((hbits&0x7FFF)==0x7C00) & ~shift_table[bits>>23];
 			else if(R == std::round_toward_infinity)
@@ -565,13 +716,15 @@ namespace half_float
 				hbits += ((((bits&0x7FFFFF&((static_cast<uint32>(1)<<(shift_table[bits>>23]))-1))!=0)|(((bits>>23)<=358)&
 					((bits>>23)!=256)))&(hbits<0xFC00)&(hbits>>15)) - ((hbits==0x7C00)&((bits>>23)!=255));
 			return hbits;
+		#endif
 		}
 
 		/// Convert IEEE double-precision to half-precision.
 		/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+		/// \tparam E `true` for round to even, `false` for round away from zero
 		/// \param value double-precision value
 		/// \return binary representation of half-precision value
-		template<std::float_round_style R> uint16 float2half_impl(double value, true_type)
+		template<std::float_round_style R,bool E> uint16 float2half_impl(double value, true_type)
 		{
 			typedef bits<float>::type uint32;
 			typedef bits<double>::type uint64;
@@ -586,10 +739,10 @@ namespace half_float
 			if(exp > 1038)
 			{
 				if(R == std::round_toward_infinity)
-					return hbits | 0x7C00 - (hbits>>15);
+					return hbits | (0x7C00-(hbits>>15));
 				if(R == std::round_toward_neg_infinity)
-					return hbits | 0x7BFF + (hbits>>15);
-				return hbits | 0x7BFF + (R!=std::round_toward_zero);
+					return hbits | (0x7BFF+(hbits>>15));
+				return hbits | (0x7BFF+(R!=std::round_toward_zero));
 			}
 			int g, s = lo != 0;
 			if(exp > 1008)
@@ -612,11 +765,7 @@ namespace half_float
 				s |= hi != 0;
 			}
 			if(R == std::round_to_nearest)
-				#if HALF_ROUND_TIES_TO_EVEN
-					hbits += g & (s|hbits);
-				#else
-					hbits += g;
-				#endif
+				hbits += g & (s|hbits|!E);
 			else if(R == std::round_toward_infinity)
 				hbits += ~(hbits>>15) & (s|g);
 			else if(R == std::round_toward_neg_infinity)
@@ -624,12 +773,35 @@ namespace half_float
 			return hbits;
 		}
 
+		/// Convert extended-precision to half-precision.
+		/// This truncates the value to double-precision, marking any discarded bits in the least significant bit, and 
+		/// converts the result from double-precision. Since the double-precision mantissa is much wider than needed for 
+		/// rounding to half-precision, this rounds exactly like converting the extended-precision value directly.
+		/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \param value extended-precision value
+		/// \return binary representation of half-precision value
+		template<std::float_round_style R,bool E> uint16 float2half_impl(long double value, true_type)
+		{
+			typedef bits<double>::type uint64;
+			double dvalue = static_cast<double>(value);
+			uint64 bits;
+			std::memcpy(&bits, &dvalue, sizeof(double));
+			if(std::abs(static_cast<long double>(dvalue)) > std::abs(value))
+				--bits;
+			if(static_cast<long double>(dvalue) != value)
+				bits |= 1;
+			std::memcpy(&dvalue, &bits, sizeof(double));
+			return float2half_impl<R,E>(dvalue, true_type());
+		}
+
 		/// Convert non-IEEE floating point to half-precision.
 		/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+		/// \tparam E `true` for round to even, `false` for round away from zero
 		/// \tparam T source type (builtin floating point type)
 		/// \param value floating point value
 		/// \return binary representation of half-precision value
-		template<std::float_round_style R,typename T> uint16 float2half_impl(T value, ...)
+		template<std::float_round_style R,bool E,typename T> uint16 float2half_impl(T value, ...)
 		{
 			uint16 hbits = static_cast<unsigned>(builtin_signbit(value)) << 15;
 			if(value == T())
@@ -660,11 +832,7 @@ namespace half_float
 			if(R == std::round_to_nearest)
 			{
 				frac = std::abs(frac);
-				#if HALF_ROUND_TIES_TO_EVEN
-					hbits += (frac>T(0.5)) | ((frac==T(0.5))&hbits);
-				#else
-					hbits += frac >= T(0.5);
-				#endif
+				hbits += (frac>T(0.5)) | ((frac==T(0.5))&(hbits|!E));
 			}
 			else if(R == std::round_toward_infinity)
 				hbits += frac > T();
@@ -673,21 +841,149 @@ namespace half_float
 			return hbits;
 		}
 
+		/// Convert floating point to half-precision.
+		/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \tparam T source type (builtin floating point type)
+		/// \param value floating point value
+		/// \return binary representation of half-precision value
+		template<std::float_round_style R,bool E,typename T> uint16 float2half(T value)
+		{
+			return float2half_impl<R,E>(value, bool_type<std::numeric_limits<T>::is_iec559&&sizeof(typename bits<T>::type)==sizeof(T)>());
+		}
+
+		/// Convert extended-precision to half-precision.
+		/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \param value extended-precision value
+		/// \return binary representation of half-precision value
+		template<std::float_round_style R,bool E> uint16 float2half(long double value)
+		{
+			return float2half_impl<R,E>(value, bool_type<std::numeric_limits<long double>::is_iec559&&std::numeric_limits<long double>::digits>=
+				std::numeric_limits<double>::digits&&std::numeric_limits<double>::is_iec559&&sizeof(bits<double>::type)==sizeof(double)>());
+		}
+
 		/// Convert floating point to half-precision.
 		/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
 		/// \tparam T source type (builtin floating point type)
 		/// \param value floating point value
 		/// \return binary representation of half-precision value
-		template<std::float_round_style R,typename T> uint16 float2half(T value)
+		template<std::float_round_style R,typename T> uint16 float2half(T value) { return float2half<R,HALF_ROUND_TIES_TO_EVEN>(value); }
+
+		/// Saturate overflowed half-precision value.
+		/// \tparam T source type (builtin floating point type)
+		/// \param hbits binary representation of half-precision value
+		/// \param value floating point value it was converted from
+		/// \return \a hbits with infinities converted from finite values replaced by the largest finite value
+		template<typename T> uint16 saturate(uint16 hbits, T value)
+		{
+			return hbits - ((hbits&0x7FFF) == 0x7C00 && value <= std::numeric_limits<T>::max() && value >= -std::numeric_limits<T>::max());
+		}
+
+		/// Mix bits of 32-bit integer.
+		/// This is a bijective integer hash with good avalanche behaviour, credit for the constants goes to 
+		/// [Chris Wellons](https://nullprogram.com/blog/2018/07/31/).
+		/// \param x value to mix
+		/// \return mixed bits
+		inline bits<float>::type mix32(bits<float>::type x)
+		{
+			x = (x^(x>>16)) & 0xFFFFFFFF;
+			x = (x*0x7FEB352D) & 0xFFFFFFFF;
+			x ^= x >> 15;
+			x = (x*0x846CA68B) & 0xFFFFFFFF;
+			return x ^ (x>>16);
+		}
+
+		/// Keys of counter-based random number generator.
+		/// These only depend on the seed and the upper 32 bits of the counter, so they can be computed once for up to 2^32 
+		/// consecutive counters.
+		struct random_key
+		{
+			/// Derive keys.
+			/// \param seed seed of generator
+			/// \param counter counter of first random number
+			random_key(unsigned long seed, std::size_t counter)
+				: k1(mix32(mix32(mix32(((counter>>16)>>16)+0x9E3779B9)^((seed>>16)>>16)) ^ (seed&0xFFFFFFFF))), k2(mix32(k1^0x85EBCA6B)) {}
+
+			/// Compute random number.
+			/// \param counter lower 32 bits of counter
+			/// \return uniformly distributed random bits
+			bits<float>::type operator()(bits<float>::type counter) const { return mix32((mix32(counter^k1)+k2) & 0xFFFFFFFF); }
+
+			/// Key for first mixing round.
+			bits<float>::type k1;
+
+			/// Key for second mixing round.
+			bits<float>::type k2;
+		};
+
+		/// Convert IEEE single-precision to half-precision with stochastic rounding.
+		/// The magnitude is rounded up with a probability equal to the distance from the next smaller half-precision 
+		/// magnitude relative to the distance between the two, with 13 bits of resolution for normal results and 24 bits for 
+		/// subnormal ones. Finite values of at least 65536 in magnitude overflow to infinity, values between 65504 and 
+		/// 65536 round to infinity with a probability as if infinity was 65536.
+		/// \param value single-precision value
+		/// \param random uniformly distributed random bits
+		/// \return binary representation of half-precision value
+		inline uint16 float2half_stochastic_impl(float value, bits<float>::type random, true_type)
+		{
+			typedef bits<float>::type uint32;
+			uint32 bits;
+			std::memcpy(&bits, &value, sizeof(float));
+			uint16 hbits = (bits>>16) & 0x8000;
+			bits &= 0x7FFFFFFF;
+			if(bits >= 0x7F800000)
+				return hbits | 0x7C00 | ((bits>>13)&0x3FF);
+			if(bits >= 0x47800000)
+				return hbits | 0x7C00;
+			if(bits >= 0x38800000)
+				return hbits | (((bits>>13)-0x1C000) + ((random&0x1FFF) < (bits&0x1FFF)));
+			float scaled = std::abs(value) * 16777216.0f;
+			int ival = static_cast<int>(scaled);
+			return hbits | (ival + (static_cast<float>(random&0xFFFFFF)*5.9604644775390625e-8f < scaled-static_cast<float>(ival)));
+		}
+
+		/// Convert non-IEEE single-precision to half-precision with stochastic rounding.
+		/// \param value single-precision value
+		/// \param random uniformly distributed random bits
+		/// \return binary representation of half-precision value
+		template<typename T> uint16 float2half_stochastic_impl(T value, bits<float>::type random, ...)
+		{
+			uint16 hbits = static_cast<unsigned>(builtin_signbit(value)) << 15;
+			if(builtin_isnan(value))
+				return hbits | 0x7FFF;
+			if(builtin_isinf(value) || value == T())
+				return hbits | (builtin_isinf(value) ? 0x7C00 : 0);
+			int exp;
+			std::frexp(value, &exp);
+			if(exp > 16)
+				return hbits | 0x7C00;
+			if(exp < -13)
+				value = std::ldexp(value, 24);
+			else
+			{
+				value = std::ldexp(value, 11-exp);
+				hbits |= ((exp+13)<<10);
+			}
+			T ival, frac = std::abs(std::modf(value, &ival));
+			hbits += static_cast<uint16>(std::abs(static_cast<int>(ival)));
+			return hbits + (static_cast<T>(random&0xFFFFFF)*T(5.9604644775390625e-8) < frac);
+		}
+
+		/// Convert single-precision to half-precision with stochastic rounding.
+		/// \param value single-precision value
+		/// \param random uniformly distributed random bits
+		/// \return binary representation of half-precision value
+		inline uint16 float2half_stochastic(float value, bits<float>::type random)
 		{
-			return float2half_impl<R>(value, bool_type<std::numeric_limits<T>::is_iec559&&sizeof(typename bits<T>::type)==sizeof(T)>());
+			return float2half_stochastic_impl(value, random, bool_type<std::numeric_limits<float>::is_iec559&&sizeof(bits<float>::type)==sizeof(float)>());
 		}
 
 		/// Convert integer to half-precision floating point.
 		/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
 		/// \tparam S `true` if value negative, `false` else
 		/// \tparam T type to convert (builtin integer type)
-		/// \param value non-negative integral value
+		/// \param value integral value, negative if \a S is `true`
 		/// \return binary representation of half-precision value
 		template<std::float_round_style R,bool S,typename T> uint16 int2half_impl(T value)
 		{
@@ -695,9 +991,9 @@ namespace half_float
 			static_assert(std::is_integral<T>::value, "int to half conversion only supports builtin integer types");
 		#endif
 			if(S)
-				value = -value;
+				value = -(value+1);
 			uint16 bits = S << 15;
-			if(value > 0xFFFF)
+			if(value > 0xFFFF-S)
 			{
 				if(R == std::round_toward_infinity)
 					bits |= 0x7C00 - S;
@@ -706,24 +1002,24 @@ namespace half_float
 				else
 					bits |= 0x7BFF + (R!=std::round_toward_zero);
 			}
-			else if(value)
+			else if(value || S)
 			{
-				unsigned int m = value, exp = 24;
+				unsigned int mag = static_cast<unsigned int>(value) + S, m = mag, exp = 24;
 				for(; m<0x400; m<<=1,--exp) ;
 				for(; m>0x7FF; m>>=1,++exp) ;
 				bits |= (exp<<10) + m;
 				if(exp > 24)
 				{
 					if(R == std::round_to_nearest)
-						bits += (value>>(exp-25)) & 1
+						bits += (mag>>(exp-25)) & 1
 						#if HALF_ROUND_TIES_TO_EVEN
-							& (((((1<<(exp-25))-1)&value)!=0)|bits)
+							& (((((1<<(exp-25))-1)&mag)!=0)|bits)
 						#endif
 						;
 					else if(R == std::round_toward_infinity)
-						bits += ((value&((1<<(exp-24))-1))!=0) & !S;
+						bits += ((mag&((1<<(exp-24))-1))!=0) & !S;
 					else if(R == std::round_toward_neg_infinity)
-						bits += ((value&((1<<(exp-24))-1))!=0) & S;
+						bits += ((mag&((1<<(exp-24))-1))!=0) & S;
 				}
 			}
 			return bits;
@@ -739,22 +1035,130 @@ namespace half_float
 			return (value<0) ? int2half_impl<R,true>(value) : int2half_impl<R,false>(value);
 		}
 
+		/// Compute single-precision bits for subnormal half-precision value.
+		/// \param m mantissa to normalize
+		/// \param e exponent bits for \a m
+		/// \return single-precision bits without sign
+		inline HALF_CONSTEXPR bits<float>::type half2float_subnormal(bits<float>::type m, bits<float>::type e)
+		{
+			return (m&0x400) ? (((m&0x3FF)<<13)|e) : half2float_subnormal(m<<1, e-0x800000);
+		}
+
+		/// Compute single-precision bits for half-precision value.
+		/// This is only used to generate the conversion table and thus not optimized for speed in any way.
+		/// \param value binary representation of half-precision value
+		/// \return binary representation of single-precision value
+		inline HALF_CONSTEXPR bits<float>::type half2float_bits(bits<float>::type value)
+		{
+			return ((value&0x8000)<<16) | (((value&0x7FFF)>=0x7C00) ? (0x7F800000|((value&0x3FF)<<13)) : 
+				((value&0x7FFF)>=0x400) ? (((value&0x7FFF)<<13)+0x38000000) : (value&0x3FF) ? 
+				half2float_subnormal(value&0x3FF, 0x38800000) : 0);
+		}
+
+	#if HALF_CONVERSION_STRATEGY == 1
+		/// Row of half-precision to single-precision conversion table.
+		struct half2float_row { bits<float>::type data[256]; };
+
+	#if HALF_ENABLE_CPP11_CONSTEXPR
+		/// List of compile-time indices.
+		template<unsigned int...> struct index_list {};
+
+		/// Concatenation of index lists, offsetting the second one.
+		template<typename,typename> struct index_concat;
+		template<unsigned int... I,unsigned int... J> struct index_concat<index_list<I...>,index_list<J...> >
+		{
+			typedef index_list<I...,(sizeof...(I)+J)...> type;
+		};
+
+		/// List of compile-time indices from 0 to \a N-1.
+		/// \tparam N number of indices
+		template<unsigned int N> struct make_index_list
+		{
+			typedef typename index_concat<typename make_index_list<N/2>::type,typename make_index_list<N-N/2>::type>::type type;
+		};
+		template<> struct make_index_list<0> { typedef index_list<> type; };
+		template<> struct make_index_list<1> { typedef index_list<0> type; };
+
+		/// Generate row of half-precision to single-precision conversion table.
+		/// \param hi upper 8 bits of half-precision values
+		/// \return conversion table row
+		template<unsigned int... I> constexpr half2float_row half2float_make_row(unsigned int hi, index_list<I...>)
+		{
+			return half2float_row{ { half2float_bits((hi<<8)|I)... } };
+		}
+
+		/// Half-precision to single-precision conversion table.
+		/// This is generated at compile-time, row by row to keep the instantiation depth and size of the index lists small.
+		template<typename> struct half2float_table;
+		template<unsigned int... I> struct half2float_table<index_list<I...> >
+		{
+			/// Table rows.
+			static constexpr half2float_row rows[sizeof...(I)] = { half2float_make_row(I, make_index_list<256>::type())... };
+		};
+		template<unsigned int... I> constexpr half2float_row half2float_table<index_list<I...> >::rows[sizeof...(I)];
+
+		/// Look up single-precision bits for half-precision value.
+		/// \param value binary representation of half-precision value
+		/// \return binary representation of single-precision value
+		inline bits<float>::type half2float_lookup(uint16 value)
+		{
+			return half2float_table<make_index_list<256>::type>::rows[value>>8].data[value&0xFF];
+		}
+	#else
+		/// Half-precision to single-precision conversion table.
+		/// This is generated at runtime, since it is too large to generate without `constexpr`.
+		struct half2float_table
+		{
+			/// Table rows.
+			half2float_row rows[256];
+
+			/// Generate table.
+			half2float_table()
+			{
+				for(unsigned int i=0; i<65536; ++i)
+					rows[i>>8].data[i&0xFF] = half2float_bits(i);
+			}
+		};
+
+		/// Look up single-precision bits for half-precision value.
+		/// The table is generated at the first call.
+		/// \param value binary representation of half-precision value
+		/// \return binary representation of single-precision value
+		inline bits<float>::type half2float_lookup(uint16 value)
+		{
+			static const half2float_table table;
+			return table.rows[value>>8].data[value&0xFF];
+		}
+	#endif
+	#endif
+
 		/// Convert half-precision to IEEE single-precision.
 		/// Credit for this goes to [Jeroen van der Zijp](ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf).
 		/// \param value binary representation of half-precision value
 		/// \return single-precision value
 		inline float half2float_impl(uint16 value, float, true_type)
 		{
+		#if HALF_NATIVE_CONVERSION
+			if((value&0x7FFF) <= 0x7C00)
+				return static_cast<float>(bits2native(value));
+		#endif
 			typedef bits<float>::type uint32;
-/*			uint32 bits = static_cast<uint32>(value&0x8000) << 16;
-			int abs = value & 0x7FFF;
-			if(abs)
+		#if HALF_CONVERSION_STRATEGY == 2
+			uint32 bits = static_cast<uint32>(value&0x8000) << 16;
+			unsigned int abs = value & 0x7FFF;
+			if(abs >= 0x7C00)
+				bits |= 0x7F800000 | (static_cast<uint32>(abs&0x3FF)<<13);
+			else if(abs >= 0x400)
+				bits |= (static_cast<uint32>(abs)<<13) + 0x38000000;
+			else if(abs)
 			{
-				bits |= 0x38000000 << static_cast<unsigned>(abs>=0x7C00);
-				for(; abs<0x400; abs<<=1,bits-=0x800000) ;
-				bits += static_cast<uint32>(abs) << 13;
+				float out = static_cast<float>(abs) * 5.9604644775390625e-08f;
+				return (value&0x8000) ? -out : out;
 			}
-*/			static const uint32 mantissa_table[2048] = { 
+		#elif HALF_CONVERSION_STRATEGY == 1
+			uint32 bits = half2float_lookup(value);
+		#else
+			static const uint32 mantissa_table[2048] = { 
 				0x00000000, 0x33800000, 0x34000000, 0x34400000, 0x34800000, 0x34A00000, 0x34C00000, 0x34E00000, 0x35000000, 0x35100000, 0x35200000, 0x35300000, 0x35400000, 0x35500000, 0x35600000, 0x35700000, 
 				0x35800000, 0x35880000, 0x35900000, 0x35980000, 0x35A00000, 0x35A80000, 0x35B00000, 0x35B80000, 0x35C00000, 0x35C80000, 0x35D00000, 0x35D80000, 0x35E00000, 0x35E80000, 0x35F00000, 0x35F80000, 
 				0x36000000, 0x36040000, 0x36080000, 0x360C0000, 0x36100000, 0x36140000, 0x36180000, 0x361C0000, 0x36200000, 0x36240000, 0x36280000, 0x362C0000, 0x36300000, 0x36340000, 0x36380000, 0x363C0000, 
@@ -892,6 +1296,7 @@ namespace half_float
 				   0, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 
 				   0, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024 };
 			uint32 bits = mantissa_table[offset_table[value>>10]+(value&0x3FF)] + exponent_table[value>>10];
+		#endif
 //			return *reinterpret_cast<float*>(&bits);			//violating strict aliasing!
 			float out;
 			std::memcpy(&out, &bits, sizeof(float));
@@ -905,14 +1310,15 @@ namespace half_float
 		{
 			typedef bits<float>::type uint32;
 			typedef bits<double>::type uint64;
-			uint32 hi = static_cast<uint32>(value&0x8000) << 16;
 			int abs = value & 0x7FFF;
-			if(abs)
+			if(abs < 0x400)
 			{
-				hi |= 0x3F000000 << static_cast<unsigned>(abs>=0x7C00);
-				for(; abs<0x400; abs<<=1,hi-=0x100000) ;
-				hi += static_cast<uint32>(abs) << 10;
+				double out = static_cast<double>(abs) * 5.9604644775390625e-08;
+				return (value&0x8000) ? -out : out;
 			}
+			uint32 hi = static_cast<uint32>(value&0x8000) << 16;
+			hi |= 0x3F000000 << static_cast<unsigned>(abs>=0x7C00);
+			hi += static_cast<uint32>(abs) << 10;
 			uint64 bits = static_cast<uint64>(hi) << 32;
 //			return *reinterpret_cast<double*>(&bits);			//violating strict aliasing!
 			double out;
@@ -948,6 +1354,12 @@ namespace half_float
 			return half2float_impl(value, T(), bool_type<std::numeric_limits<T>::is_iec559&&sizeof(typename bits<T>::type)==sizeof(T)>());
 		}
 
+		/// Convert half-precision to extended-precision.
+		/// This converts to double-precision first, which represents every half-precision value exactly.
+		/// \param value binary representation of half-precision value
+		/// \return extended-precision value
+		template<> inline long double half2float<long double>(uint16 value) { return static_cast<long double>(half2float<double>(value)); }
+
 		/// Convert half-precision floating point to integer.
 		/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
 		/// \tparam E `true` for round to even, `false` for round away from zero
@@ -1046,74 +1458,422 @@ namespace half_float
 		inline uint16 round_half_up(uint16 value) { return round_half_impl<std::round_to_nearest,0>(value); }
 		/// \}
 
-		struct functions;
-		template<typename> struct unary_specialized;
-		template<typename,typename> struct binary_specialized;
-		template<typename,typename,std::float_round_style> struct half_caster;
-	}
-
-	/// Half-precision floating point type.
-	/// This class implements an IEEE-conformant half-precision floating point type with the usual arithmetic operators and 
-	/// conversions. It is implicitly convertible to single-precision floating point, which makes artihmetic expressions and 
-	/// functions with mixed-type operands to be of the most precise operand type. Additionally all arithmetic operations 
-	/// (and many mathematical functions) are carried out in single-precision internally. All conversions from single- to 
-	/// half-precision are done using the library's default rounding mode, but temporary results inside chained arithmetic 
-	/// expressions are kept in single-precision as long as possible (while of course still maintaining a strong half-precision type).
-	///
-	/// According to the C++98/03 definition, the half type is not a POD type. But according to C++11's less strict and 
-	/// extended definitions it is both a standard layout type and a trivially copyable type (even if not a POD type), which 
-	/// means it can be standard-conformantly copied using raw binary copies. But in this context some more words about the 
-	/// actual size of the type. Although the half is representing an IEEE 16-bit type, it does not neccessarily have to be of 
-	/// exactly 16-bits size. But on any reasonable implementation the actual binary representation of this type will most 
-	/// probably not ivolve any additional "magic" or padding beyond the simple binary representation of the underlying 16-bit 
-	/// IEEE number, even if not strictly guaranteed by the standard. But even then it only has an actual size of 16 bits if 
-	/// your C++ implementation supports an unsigned integer type of exactly 16 bits width. But this should be the case on 
-	/// nearly any reasonable platform.
-	///
-	/// So if your C++ implementation is not totally exotic or imposes special alignment requirements, it is a reasonable 
-	/// assumption that the data of a half is just comprised of the 2 bytes of the underlying IEEE representation.
-	class half
-	{
-		friend struct detail::functions;
-		friend struct detail::unary_specialized<half>;
-		friend struct detail::binary_specialized<half,half>;
-		template<typename,typename,std::float_round_style> friend struct detail::half_caster;
-		friend class std::numeric_limits<half>;
-	#if HALF_ENABLE_CPP11_HASH
-		friend struct std::hash<half>;
-	#endif
-	#if HALF_ENABLE_CPP11_USER_LITERALS
-		friend half literal::operator""_h(long double);
-	#endif
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		/// \name SIMD support
+		/// \{
 
-	public:
-		/// Default constructor.
-		/// This initializes the half to 0. Although this does not match the builtin types' default-initialization semantics 
-		/// and may be less efficient than no initialization, it is needed to provide proper value-initialization semantics.
-		HALF_CONSTEXPR half() HALF_NOEXCEPT : data_() {}
+		/// Instruction set extensions usable for bulk operations.
+		enum cpu_feature { cpu_f16c = 1, cpu_avx2 = 2 };
 
-		/// Copy constructor.
-		/// \tparam T type of concrete half expression
-		/// \param rhs half expression to copy from
-		half(detail::expr rhs) : data_(detail::float2half<round_style>(static_cast<float>(rhs))) {}
+		/// Query instruction set extensions of the executing processor.
+		/// This also checks that the operating system saves the AVX register state, without which neither F16C nor AVX2 
+		/// instructions are usable.
+		/// \return combination of supported cpu_feature flags
+		inline unsigned int query_cpu_features()
+		{
+			unsigned int features = 0;
+		#if HALF_ENABLE_F16C_INTRINSICS
+			unsigned int regs[4] = { 0, 0, 0, 0 }, max_leaf;
+			#if defined(_MSC_VER)
+				int info[4];
+				__cpuid(info, 0);
+				max_leaf = static_cast<unsigned int>(info[0]);
+				__cpuid(info, 1);
+				for(int i=0; i<4; ++i) regs[i] = static_cast<unsigned int>(info[i]);
+			#else
+				max_leaf = __get_cpuid_max(0, 0);
+				__get_cpuid(1, regs, regs+1, regs+2, regs+3);
+			#endif
+			if((regs[2]&0x18000000) != 0x18000000)		//OSXSAVE and AVX
+				return features;
+			#if defined(_MSC_VER)
+				unsigned long long xcr0 = _xgetbv(0);
+			#else
+				unsigned int xcr0, xcr0_hi;
+				__asm__ __volatile__("xgetbv" : "=a"(xcr0), "=d"(xcr0_hi) : "c"(0));
+			#endif
+			if((xcr0&0x6) != 0x6)						//XMM and YMM state
+				return features;
+			if(regs[2] & 0x20000000)
+				features |= cpu_f16c;
+			if(max_leaf >= 7)
+			{
+			#if defined(_MSC_VER)
+				__cpuidex(info, 7, 0);
+				regs[1] = static_cast<unsigned int>(info[1]);
+			#else
+				__cpuid_count(7, 0, regs[0], regs[1], regs[2], regs[3]);
+			#endif
+				if(regs[1] & 0x20)
+					features |= cpu_avx2;
+			}
+		#endif
+			return features;
+		}
 
-		/// Conversion constructor.
-		/// \param rhs float to convert
-		explicit half(float rhs) : data_(detail::float2half<round_style>(rhs)) {}
-	
-		/// Conversion to single-precision.
-		/// \return single precision value representing expression value
-		operator float() const { return detail::half2float<float>(data_); }
+		/// Check for instruction set extensions.
+		/// The processor is only queried once and the result cached for subsequent calls.
+		/// \param feature combination of cpu_feature flags to check
+		/// \retval true if all features supported
+		/// \retval false else
+		inline bool cpu_supports(unsigned int feature)
+		{
+			static const unsigned int features = query_cpu_features();
+			return (features&feature) == feature;
+		}
 
-		/// Assignment operator.
-		/// \tparam T type of concrete half expression
-		/// \param rhs half expression to copy from
-		/// \return reference to this half
-		half& operator=(detail::expr rhs) { return *this = static_cast<float>(rhs); }
+		/// Bitwise selection.
+		/// \param mask selection mask
+		/// \param a bits to take where \a mask is set
+		/// \param b bits to take where \a mask is clear
+		/// \return combined bits
+		inline __m128i select(__m128i mask, __m128i a, __m128i b)
+		{
+			return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+		}
 
-		/// Arithmetic assignment.
-		/// \tparam T type of concrete half expression
-		/// \param rhs half expression to add
+		/// Convert IEEE single-precision to half-precision using SSE2.
+		/// This computes exactly the same results as float2half_impl() for all inputs, but for 4 values at once.
+		/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \tparam S `true` for saturating overflows to the largest finite value, `false` for overflowing to infinity
+		/// \param value single-precision values
+		/// \return binary representations of half-precision values in the lower halves of 32-bit lanes
+		template<std::float_round_style R,bool E,bool S> __m128i float2half_sse2(__m128 value)
+		{
+			__m128i bits = _mm_castps_si128(value), zero = _mm_setzero_si128();
+			__m128i sign = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+			__m128i abs = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+
+			//normal range: truncate mantissa and keep remainder
+			__m128i hbits = _mm_sub_epi32(_mm_srli_epi32(abs, 13), _mm_set1_epi32(0x1C000));
+			__m128i rem = _mm_and_si128(abs, _mm_set1_epi32(0x1FFF));
+			__m128i gt = _mm_cmpgt_epi32(rem, _mm_set1_epi32(0x1000));
+			__m128i eq = _mm_cmpeq_epi32(rem, _mm_set1_epi32(0x1000));
+			__m128i nz = _mm_xor_si128(_mm_cmpeq_epi32(rem, zero), _mm_set1_epi32(-1));
+
+			//subnormal range: scale to integer part and fraction, both exact
+			__m128i sub = _mm_cmplt_epi32(abs, _mm_set1_epi32(0x38800000));
+			if(_mm_movemask_epi8(sub))
+			{
+				__m128 scaled = _mm_mul_ps(_mm_castsi128_ps(abs), _mm_set1_ps(16777216.0f));
+				__m128i ival = _mm_cvttps_epi32(scaled);
+				__m128 frac = _mm_sub_ps(scaled, _mm_cvtepi32_ps(ival));
+				hbits = select(sub, ival, hbits);
+				gt = select(sub, _mm_castps_si128(_mm_cmpgt_ps(frac, _mm_set1_ps(0.5f))), gt);
+				eq = select(sub, _mm_castps_si128(_mm_cmpeq_ps(frac, _mm_set1_ps(0.5f))), eq);
+				nz = select(sub, _mm_castps_si128(_mm_cmpneq_ps(frac, _mm_setzero_ps())), nz);
+			}
+
+			//overflow: largest finite value with remainder above half
+			__m128i ovf = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x477FFFFF));
+			hbits = select(ovf, _mm_set1_epi32(0x7BFF), hbits);
+			gt = _mm_or_si128(gt, ovf);
+			eq = _mm_andnot_si128(ovf, eq);
+			nz = _mm_or_si128(nz, ovf);
+
+			//rounding, increment masks are all ones
+			__m128i inc;
+			if(R == std::round_to_nearest)
+				inc = _mm_or_si128(gt, E ? _mm_and_si128(eq, _mm_sub_epi32(zero, _mm_and_si128(hbits, _mm_set1_epi32(1)))) : eq);
+			else if(R == std::round_toward_infinity)
+				inc = _mm_andnot_si128(_mm_srai_epi32(bits, 31), nz);
+			else if(R == std::round_toward_neg_infinity)
+				inc = _mm_and_si128(_mm_srai_epi32(bits, 31), nz);
+			else if(R == std::round_toward_zero)
+				inc = zero;
+			else
+				inc = ovf;
+			if(S)
+				inc = _mm_andnot_si128(_mm_cmpeq_epi32(hbits, _mm_set1_epi32(0x7BFF)), inc);
+			hbits = _mm_sub_epi32(hbits, inc);
+
+			//infinity and NaN
+			__m128i inf = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7F7FFFFF));
+			hbits = select(inf, _mm_or_si128(_mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(0x3FF)), _mm_set1_epi32(0x7C00)), hbits);
+			return _mm_or_si128(hbits, sign);
+		}
+
+		/// Convert half-precision to IEEE single-precision using SSE2.
+		/// This computes exactly the same results as half2float_impl() for all inputs, but for 4 values at once and without 
+		/// any table lookups.
+		/// \param value binary representations of half-precision values in the lower halves of 32-bit lanes
+		/// \return single-precision values
+		inline __m128 half2float_sse2(__m128i value)
+		{
+			__m128i zero = _mm_setzero_si128(), exp_mask = _mm_set1_epi32(0x0F800000);
+			__m128i sign = _mm_slli_epi32(_mm_and_si128(value, _mm_set1_epi32(0x8000)), 16);
+			__m128i bits = _mm_slli_epi32(_mm_and_si128(value, _mm_set1_epi32(0x7FFF)), 13);
+			__m128i exp = _mm_and_si128(bits, exp_mask);
+			__m128i inf = _mm_cmpeq_epi32(exp, exp_mask), sub = _mm_cmpeq_epi32(exp, zero);
+			bits = _mm_add_epi32(bits, _mm_set1_epi32(0x38000000));
+			bits = _mm_add_epi32(bits, _mm_and_si128(inf, _mm_set1_epi32(0x38000000)));
+			__m128i denorm = _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(0x00800000))), 
+				_mm_set1_ps(6.103515625e-05f)));
+			return _mm_castsi128_ps(_mm_or_si128(select(sub, denorm, bits), sign));
+		}
+
+		/// Narrow IEEE double-precision to single-precision for conversion to half-precision.
+		/// This does not round the values to single-precision but rather truncates them, marking any discarded bits in the 
+		/// least significant bit and clamping values way outside the half-precision range. Converting the results to 
+		/// half-precision thus gives exactly the same results as float2half_impl() does for the double-precision values.
+		/// \param lo first 2 double-precision values
+		/// \param hi last 2 double-precision values
+		/// \return single-precision values with same half-precision rounding behaviour
+		inline __m128 double2float_sse2(__m128d lo, __m128d hi)
+		{
+			__m128i zero = _mm_setzero_si128(), ones = _mm_set1_epi32(-1);
+			__m128i high = _mm_castps_si128(_mm_shuffle_ps(_mm_castpd_ps(lo), _mm_castpd_ps(hi), _MM_SHUFFLE(3, 1, 3, 1)));
+			__m128i low = _mm_castps_si128(_mm_shuffle_ps(_mm_castpd_ps(lo), _mm_castpd_ps(hi), _MM_SHUFFLE(2, 0, 2, 0)));
+			__m128i sign = _mm_and_si128(high, _mm_set1_epi32(0x80000000));
+			__m128i abs = _mm_or_si128(_mm_and_si128(high, _mm_set1_epi32(0x7FFFFFFF)), 
+				_mm_srli_epi32(_mm_xor_si128(_mm_cmpeq_epi32(low, zero), ones), 31));
+			__m128i bits = _mm_slli_epi32(_mm_sub_epi32(abs, _mm_set1_epi32(0x38000000)), 3);
+			bits = select(_mm_cmplt_epi32(abs, _mm_set1_epi32(0x38100000)), 
+				_mm_andnot_si128(_mm_cmpeq_epi32(abs, zero), _mm_set1_epi32(0x00800000)), bits);
+			bits = select(_mm_cmpgt_epi32(abs, _mm_set1_epi32(0x47EFFFFF)), _mm_set1_epi32(0x7F000000), bits);
+			bits = select(_mm_cmpeq_epi32(abs, _mm_set1_epi32(0x7FF00000)), _mm_set1_epi32(0x7F800000), bits);
+			bits = select(_mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7FF00000)), _mm_set1_epi32(0x7FFFFFFF), bits);
+			return _mm_castsi128_ps(_mm_or_si128(bits, sign));
+		}
+
+		/// Convert half-precision to IEEE double-precision using SSE2.
+		/// This computes exactly the same results as half2float_impl() for all inputs, but for 4 values at once.
+		/// \param value binary representations of half-precision values in the lower halves of 32-bit lanes
+		/// \param dst address to store 4 double-precision values at
+		inline void half2double_sse2(__m128i value, double *dst)
+		{
+			__m128i zero = _mm_setzero_si128(), exp_mask = _mm_set1_epi32(0x7C00);
+			__m128i abs = _mm_and_si128(value, _mm_set1_epi32(0x7FFF)), exp = _mm_and_si128(abs, exp_mask);
+			__m128i inf = _mm_cmpeq_epi32(exp, exp_mask), sub = _mm_cmpeq_epi32(exp, zero);
+			__m128i hi = _mm_add_epi32(_mm_add_epi32(_mm_slli_epi32(abs, 10), _mm_set1_epi32(0x3F000000)), 
+				_mm_and_si128(inf, _mm_set1_epi32(0x3F000000)));
+			__m128i sign = _mm_slli_epi32(_mm_and_si128(value, _mm_set1_epi32(0x8000)), 16);
+			hi = _mm_add_epi32(hi, _mm_and_si128(sub, _mm_set1_epi32(0x00100000)));
+			__m128d magic = _mm_set1_pd(6.103515625e-05);
+			__m128i lo_bits = _mm_unpacklo_epi32(zero, hi), hi_bits = _mm_unpackhi_epi32(zero, hi);
+			__m128i lo_sub = _mm_unpacklo_epi32(sub, sub), hi_sub = _mm_unpackhi_epi32(sub, sub);
+			lo_bits = select(lo_sub, _mm_castpd_si128(_mm_sub_pd(_mm_castsi128_pd(lo_bits), magic)), lo_bits);
+			hi_bits = select(hi_sub, _mm_castpd_si128(_mm_sub_pd(_mm_castsi128_pd(hi_bits), magic)), hi_bits);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_or_si128(lo_bits, _mm_unpacklo_epi32(zero, sign)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+2), _mm_or_si128(hi_bits, _mm_unpackhi_epi32(zero, sign)));
+		}
+
+		/// Pack half-precision values from 32-bit lanes.
+		/// \param lo binary representations of first 4 half-precision values in 32-bit lanes
+		/// \param hi binary representations of last 4 half-precision values in 32-bit lanes
+		/// \return binary representations of 8 half-precision values in 16-bit lanes
+		inline __m128i pack_halfs(__m128i lo, __m128i hi)
+		{
+			return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16), _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
+		}
+
+		/// Multiply 32-bit integers using SSE2.
+		/// \param a first factors
+		/// \param b second factors
+		/// \return lower 32 bits of products
+		inline __m128i mullo_sse2(__m128i a, __m128i b)
+		{
+			__m128i even = _mm_mul_epu32(a, b), odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+			return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0,0,2,0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0,0,2,0)));
+		}
+
+		/// Mix bits of 32-bit integers using SSE2.
+		/// This computes exactly the same results as mix32(), but for 4 values at once.
+		/// \param x values to mix
+		/// \return mixed bits
+		inline __m128i mix32_sse2(__m128i x)
+		{
+			x = mullo_sse2(_mm_xor_si128(x, _mm_srli_epi32(x, 16)), _mm_set1_epi32(0x7FEB352D));
+			x = mullo_sse2(_mm_xor_si128(x, _mm_srli_epi32(x, 15)), _mm_set1_epi32(static_cast<int>(0x846CA68B)));
+			return _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+		}
+
+		/// Convert IEEE single-precision to half-precision with stochastic rounding using SSE2.
+		/// This computes exactly the same results as float2half_stochastic_impl() for all inputs, but for 4 values at once.
+		/// \param value single-precision values
+		/// \param random uniformly distributed random bits
+		/// \return binary representations of half-precision values in the lower halves of 32-bit lanes
+		inline __m128i float2half_stochastic_sse2(__m128 value, __m128i random)
+		{
+			__m128i bits = _mm_castps_si128(value);
+			__m128i sign = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+			__m128i abs = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+
+			//normal range: truncate mantissa and compare remainder with random bits
+			__m128i hbits = _mm_sub_epi32(_mm_srli_epi32(abs, 13), _mm_set1_epi32(0x1C000));
+			__m128i inc = _mm_cmplt_epi32(_mm_and_si128(random, _mm_set1_epi32(0x1FFF)), _mm_and_si128(abs, _mm_set1_epi32(0x1FFF)));
+
+			//subnormal range: scale to integer part and fraction, both exact
+			__m128i sub = _mm_cmplt_epi32(abs, _mm_set1_epi32(0x38800000));
+			if(_mm_movemask_epi8(sub))
+			{
+				__m128 scaled = _mm_mul_ps(_mm_castsi128_ps(abs), _mm_set1_ps(16777216.0f));
+				__m128i ival = _mm_cvttps_epi32(scaled);
+				__m128 threshold = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(random, _mm_set1_epi32(0xFFFFFF))), _mm_set1_ps(5.9604644775390625e-8f));
+				hbits = select(sub, ival, hbits);
+				inc = select(sub, _mm_castps_si128(_mm_cmplt_ps(threshold, _mm_sub_ps(scaled, _mm_cvtepi32_ps(ival)))), inc);
+			}
+			hbits = _mm_sub_epi32(hbits, inc);
+
+			//overflow, infinity and NaN
+			hbits = select(_mm_cmpgt_epi32(abs, _mm_set1_epi32(0x477FFFFF)), _mm_set1_epi32(0x7C00), hbits);
+			__m128i inf = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7F7FFFFF));
+			hbits = select(inf, _mm_or_si128(_mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(0x3FF)), _mm_set1_epi32(0x7C00)), hbits);
+			return _mm_or_si128(hbits, sign);
+		}
+
+	#if HALF_ENABLE_F16C_INTRINSICS
+		/// Bitwise selection.
+		/// \param mask selection mask
+		/// \param a bits to take where \a mask is set
+		/// \param b bits to take where \a mask is clear
+		/// \return combined bits
+		inline HALF_TARGET("avx2") __m256i select(__m256i mask, __m256i a, __m256i b)
+		{
+			return _mm256_or_si256(_mm256_and_si256(mask, a), _mm256_andnot_si256(mask, b));
+		}
+
+		/// Convert IEEE single-precision to half-precision using AVX2.
+		/// This is the same algorithm as float2half_sse2(), but for 8 values at once.
+		/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \tparam S `true` for saturating overflows to the largest finite value, `false` for overflowing to infinity
+		/// \param value single-precision values
+		/// \return binary representations of half-precision values
+		template<std::float_round_style R,bool E,bool S> HALF_TARGET("avx2") __m128i float2half_avx2(__m256 value)
+		{
+			__m256i bits = _mm256_castps_si256(value), zero = _mm256_setzero_si256();
+			__m256i sign = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(0x8000));
+			__m256i abs = _mm256_and_si256(bits, _mm256_set1_epi32(0x7FFFFFFF));
+
+			//normal range: truncate mantissa and keep remainder
+			__m256i hbits = _mm256_sub_epi32(_mm256_srli_epi32(abs, 13), _mm256_set1_epi32(0x1C000));
+			__m256i rem = _mm256_and_si256(abs, _mm256_set1_epi32(0x1FFF));
+			__m256i gt = _mm256_cmpgt_epi32(rem, _mm256_set1_epi32(0x1000));
+			__m256i eq = _mm256_cmpeq_epi32(rem, _mm256_set1_epi32(0x1000));
+			__m256i nz = _mm256_xor_si256(_mm256_cmpeq_epi32(rem, zero), _mm256_set1_epi32(-1));
+
+			//subnormal range: scale to integer part and fraction, both exact
+			__m256i sub = _mm256_cmpgt_epi32(_mm256_set1_epi32(0x38800000), abs);
+			if(_mm256_movemask_epi8(sub))
+			{
+				__m256 scaled = _mm256_mul_ps(_mm256_castsi256_ps(abs), _mm256_set1_ps(16777216.0f));
+				__m256i ival = _mm256_cvttps_epi32(scaled);
+				__m256 frac = _mm256_sub_ps(scaled, _mm256_cvtepi32_ps(ival));
+				hbits = select(sub, ival, hbits);
+				gt = select(sub, _mm256_castps_si256(_mm256_cmp_ps(frac, _mm256_set1_ps(0.5f), _CMP_GT_OQ)), gt);
+				eq = select(sub, _mm256_castps_si256(_mm256_cmp_ps(frac, _mm256_set1_ps(0.5f), _CMP_EQ_OQ)), eq);
+				nz = select(sub, _mm256_castps_si256(_mm256_cmp_ps(frac, _mm256_setzero_ps(), _CMP_NEQ_UQ)), nz);
+			}
+
+			//overflow: largest finite value with remainder above half
+			__m256i ovf = _mm256_cmpgt_epi32(abs, _mm256_set1_epi32(0x477FFFFF));
+			hbits = select(ovf, _mm256_set1_epi32(0x7BFF), hbits);
+			gt = _mm256_or_si256(gt, ovf);
+			eq = _mm256_andnot_si256(ovf, eq);
+			nz = _mm256_or_si256(nz, ovf);
+
+			//rounding, increment masks are all ones
+			__m256i inc;
+			if(R == std::round_to_nearest)
+				inc = _mm256_or_si256(gt, E ? _mm256_and_si256(eq, _mm256_sub_epi32(zero, _mm256_and_si256(hbits, _mm256_set1_epi32(1)))) : eq);
+			else if(R == std::round_toward_infinity)
+				inc = _mm256_andnot_si256(_mm256_srai_epi32(bits, 31), nz);
+			else if(R == std::round_toward_neg_infinity)
+				inc = _mm256_and_si256(_mm256_srai_epi32(bits, 31), nz);
+			else if(R == std::round_toward_zero)
+				inc = zero;
+			else
+				inc = ovf;
+			if(S)
+				inc = _mm256_andnot_si256(_mm256_cmpeq_epi32(hbits, _mm256_set1_epi32(0x7BFF)), inc);
+			hbits = _mm256_sub_epi32(hbits, inc);
+
+			//infinity and NaN
+			__m256i inf = _mm256_cmpgt_epi32(abs, _mm256_set1_epi32(0x7F7FFFFF));
+			hbits = select(inf, _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(abs, 13), _mm256_set1_epi32(0x3FF)), 
+				_mm256_set1_epi32(0x7C00)), hbits);
+			hbits = _mm256_srai_epi32(_mm256_slli_epi32(_mm256_or_si256(hbits, sign), 16), 16);
+			return _mm_packs_epi32(_mm256_castsi256_si128(hbits), _mm256_extracti128_si256(hbits, 1));
+		}
+	#endif
+
+
+		/// \}
+	#endif
+
+		struct functions;
+		template<typename> struct unary_specialized;
+		template<typename,typename> struct binary_specialized;
+		template<typename,typename,std::float_round_style> struct half_caster;
+		struct bulk;
+	}
+
+	/// Half-precision floating point type.
+	/// This class implements an IEEE-conformant half-precision floating point type with the usual arithmetic operators and 
+	/// conversions. It is implicitly convertible to single-precision floating point, which makes artihmetic expressions and 
+	/// functions with mixed-type operands to be of the most precise operand type. Additionally all arithmetic operations 
+	/// (and many mathematical functions) are carried out in single-precision internally. All conversions from single- to 
+	/// half-precision are done using the library's default rounding mode, but temporary results inside chained arithmetic 
+	/// expressions are kept in single-precision as long as possible (while of course still maintaining a strong half-precision type).
+	///
+	/// According to the C++98/03 definition, the half type is not a POD type. But according to C++11's less strict and 
+	/// extended definitions it is both a standard layout type and a trivially copyable type (even if not a POD type), which 
+	/// means it can be standard-conformantly copied using raw binary copies. But in this context some more words about the 
+	/// actual size of the type. Although the half is representing an IEEE 16-bit type, it does not neccessarily have to be of 
+	/// exactly 16-bits size. But on any reasonable implementation the actual binary representation of this type will most 
+	/// probably not ivolve any additional "magic" or padding beyond the simple binary representation of the underlying 16-bit 
+	/// IEEE number, even if not strictly guaranteed by the standard. But even then it only has an actual size of 16 bits if 
+	/// your C++ implementation supports an unsigned integer type of exactly 16 bits width. But this should be the case on 
+	/// nearly any reasonable platform.
+	///
+	/// So if your C++ implementation is not totally exotic or imposes special alignment requirements, it is a reasonable 
+	/// assumption that the data of a half is just comprised of the 2 bytes of the underlying IEEE representation.
+	class half
+	{
+		friend struct detail::functions;
+		friend struct detail::unary_specialized<half>;
+		friend struct detail::binary_specialized<half,half>;
+		template<typename,typename,std::float_round_style> friend struct detail::half_caster;
+		friend struct detail::bulk;
+		friend class function_table;
+		friend class std::numeric_limits<half>;
+	#if HALF_ENABLE_CPP11_HASH
+		friend struct std::hash<half>;
+	#endif
+	#if HALF_ENABLE_CPP11_USER_LITERALS
+		friend half literal::operator""_h(long double);
+	#endif
+
+	public:
+		/// Default constructor.
+		/// This initializes the half to 0. Although this does not match the builtin types' default-initialization semantics 
+		/// and may be less efficient than no initialization, it is needed to provide proper value-initialization semantics.
+		HALF_CONSTEXPR half() HALF_NOEXCEPT : data_() {}
+
+		/// Copy constructor.
+		/// \tparam T type of concrete half expression
+		/// \param rhs half expression to copy from
+		half(detail::expr rhs) : data_(detail::float2half<round_style>(static_cast<float>(rhs))) {}
+
+		/// Conversion constructor.
+		/// \param rhs float to convert
+		explicit half(float rhs) : data_(detail::float2half<round_style>(rhs)) {}
+	
+		/// Conversion to single-precision.
+		/// \return single precision value representing expression value
+		operator float() const { return detail::half2float<float>(data_); }
+
+		/// Assignment operator.
+		/// \tparam T type of concrete half expression
+		/// \param rhs half expression to copy from
+		/// \return reference to this half
+		half& operator=(detail::expr rhs) { return *this = static_cast<float>(rhs); }
+
+		/// Arithmetic assignment.
+		/// \tparam T type of concrete half expression
+		/// \param rhs half expression to add
 		/// \return reference to this half
 		template<typename T> typename detail::enable<half&,T>::type operator+=(T rhs) { return *this += static_cast<float>(rhs); }
 
@@ -1135,6 +1895,32 @@ namespace half_float
 		/// \return reference to this half
 		template<typename T> typename detail::enable<half&,T>::type operator/=(T rhs) { return *this /= static_cast<float>(rhs); }
 
+	#if HALF_NATIVE_ARITHMETIC
+		/// Arithmetic assignment.
+		/// This computes directly in the native half-precision type.
+		/// \param rhs half to add
+		/// \return reference to this half
+		half& operator+=(half rhs) { data_ = detail::native2bits(detail::bits2native(data_)+detail::bits2native(rhs.data_)); return *this; }
+
+		/// Arithmetic assignment.
+		/// This computes directly in the native half-precision type.
+		/// \param rhs half to subtract
+		/// \return reference to this half
+		half& operator-=(half rhs) { data_ = detail::native2bits(detail::bits2native(data_)-detail::bits2native(rhs.data_)); return *this; }
+
+		/// Arithmetic assignment.
+		/// This computes directly in the native half-precision type.
+		/// \param rhs half to multiply with
+		/// \return reference to this half
+		half& operator*=(half rhs) { data_ = detail::native2bits(detail::bits2native(data_)*detail::bits2native(rhs.data_)); return *this; }
+
+		/// Arithmetic assignment.
+		/// This computes directly in the native half-precision type.
+		/// \param rhs half to divide by
+		/// \return reference to this half
+		half& operator/=(half rhs) { data_ = detail::native2bits(detail::bits2native(data_)/detail::bits2native(rhs.data_)); return *this; }
+	#endif
+
 		/// Assignment operator.
 		/// \param rhs single-precision value to copy from
 		/// \return reference to this half
@@ -1188,6 +1974,49 @@ namespace half_float
 		detail::uint16 data_;
 	};
 
+	/// Statistics of bulk conversions to half-precision.
+	/// This is filled by the [convert](\ref half_float::convert(const float*,half*,std::size_t,conversion_stats&)) overloads 
+	/// collecting statistics. The counters are only ever added to and the error only ever increased, so the same object can 
+	/// accumulate statistics over many conversions.
+	struct conversion_stats
+	{
+		/// Construct empty statistics.
+		conversion_stats() : overflow(0), underflow(0), subnormal(0), nan(0), max_error(0.0f) {}
+
+		/// Number of finite values converted to infinity.
+		std::size_t overflow;
+
+		/// Number of nonzero values converted to zero.
+		std::size_t underflow;
+
+		/// Number of values converted to subnormal halfs.
+		std::size_t subnormal;
+
+		/// Number of NaNs.
+		std::size_t nan;
+
+		/// Maximum relative error of all finite nonzero values that didn't overflow.
+		float max_error;
+	};
+
+	/// Random number generator for stochastic rounding.
+	/// This is a counter-based generator: the random number used for rounding a value only depends on the seed and the 
+	/// current counter, which is advanced by one for each rounded value. The same seed and counter thus always reproduce 
+	/// the same results, no matter if the values are converted one by one, in bulk or in parallel by any number of threads.
+	struct stochastic_rng
+	{
+		/// Construct generator.
+		/// \param s seed of random numbers
+		/// \param c counter of first random number
+		explicit stochastic_rng(unsigned long s = 0, std::size_t c = 0) : seed(s), counter(c) {}
+
+		/// Seed of random numbers.
+		unsigned long seed;
+
+		/// Counter of next random number.
+		std::size_t counter;
+	};
+
 #if HALF_ENABLE_CPP11_USER_LITERALS
 	namespace literal
 	{
@@ -2107,60 +2936,3968 @@ namespace half_float
 		};
 		template<std::float_round_style R> struct half_caster<half,expr,R> : half_caster<half,half,R> {};
 
-		/// \name Comparison operators
-		/// \{
-
-		/// Comparison for equality.
-		/// \param x first operand
-		/// \param y second operand
-		/// \retval true if operands equal
-		/// \retval false else
-		template<typename T,typename U> typename enable<bool,T,U>::type operator==(T x, U y) { return functions::isequal(x, y); }
+		/// Integer types supported by bulk conversions.
+		/// Specializations provide the range of each type as single-precision bounds in `lower()` and `upper()` and, if SSE2 is 
+		/// available, `load()` and `store()` for reading and writing 4 values in 32-bit lanes.
+		/// \tparam T builtin integer type
+		template<typename T> struct bulk_int;
 
-		/// Comparison for inequality.
-		/// \param x first operand
-		/// \param y second operand
-		/// \retval true if operands not equal
-		/// \retval false else
-		template<typename T,typename U> typename enable<bool,T,U>::type operator!=(T x, U y) { return functions::isnotequal(x, y); }
+		/// Signed 8-bit integers for bulk conversions.
+		template<> struct bulk_int<signed char>
+		{
+			static HALF_CONSTEXPR float lower() { return -128.0f; }
+			static HALF_CONSTEXPR float upper() { return 127.0f; }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			static __m128i load(const signed char *src)
+			{
+				int bytes;
+				std::memcpy(&bytes, src, 4);
+				__m128i x = _mm_cvtsi32_si128(bytes);
+				x = _mm_unpacklo_epi8(x, x);
+				return _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 24);
+			}
+			static void store(signed char *dst, __m128i x)
+			{
+				x = _mm_packs_epi32(x, x);
+				int bytes = _mm_cvtsi128_si32(_mm_packs_epi16(x, x));
+				std::memcpy(dst, &bytes, 4);
+			}
+		#endif
+		};
 
-		/// Comparison for less than.
-		/// \param x first operand
-		/// \param y second operand
-		/// \retval true if \a x less than \a y
-		/// \retval false else
-		template<typename T,typename U> typename enable<bool,T,U>::type operator<(T x, U y) { return functions::isless(x, y); }
+		/// Unsigned 8-bit integers for bulk conversions.
+		template<> struct bulk_int<unsigned char>
+		{
+			static HALF_CONSTEXPR float lower() { return 0.0f; }
+			static HALF_CONSTEXPR float upper() { return 255.0f; }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			static __m128i load(const unsigned char *src)
+			{
+				int bytes;
+				std::memcpy(&bytes, src, 4);
+				__m128i zero = _mm_setzero_si128();
+				return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), zero), zero);
+			}
+			static void store(unsigned char *dst, __m128i x)
+			{
+				x = _mm_packs_epi32(x, x);
+				int bytes = _mm_cvtsi128_si32(_mm_packus_epi16(x, x));
+				std::memcpy(dst, &bytes, 4);
+			}
+		#endif
+		};
 
-		/// Comparison for greater than.
-		/// \param x first operand
-		/// \param y second operand
-		/// \retval true if \a x greater than \a y
-		/// \retval false else
-		template<typename T,typename U> typename enable<bool,T,U>::type operator>(T x, U y) { return functions::isgreater(x, y); }
+		/// Signed 16-bit integers for bulk conversions.
+		template<> struct bulk_int<short>
+		{
+			static HALF_CONSTEXPR float lower() { return -32768.0f; }
+			static HALF_CONSTEXPR float upper() { return 32767.0f; }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			static __m128i load(const short *src)
+			{
+				__m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+				return _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+			}
+			static void store(short *dst, __m128i x) { _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(x, x)); }
+		#endif
+		};
 
-		/// Comparison for less equal.
-		/// \param x first operand
-		/// \param y second operand
-		/// \retval true if \a x less equal \a y
-		/// \retval false else
-		template<typename T,typename U> typename enable<bool,T,U>::type operator<=(T x, U y) { return functions::islessequal(x, y); }
+		/// Unsigned 16-bit integers for bulk conversions.
+		template<> struct bulk_int<unsigned short>
+		{
+			static HALF_CONSTEXPR float lower() { return 0.0f; }
+			static HALF_CONSTEXPR float upper() { return 65535.0f; }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			static __m128i load(const unsigned short *src)
+			{
+				return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)), _mm_setzero_si128());
+			}
+			static void store(unsigned short *dst, __m128i x)
+			{
+				x = _mm_sub_epi32(x, _mm_set1_epi32(0x8000));
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_xor_si128(_mm_packs_epi32(x, x), _mm_set1_epi16(-0x8000)));
+			}
+		#endif
+		};
 
-		/// Comparison for greater equal.
-		/// \param x first operand
-		/// \param y second operand
-		/// \retval true if \a x greater equal \a y
-		/// \retval false else
-		template<typename T,typename U> typename enable<bool,T,U>::type operator>=(T x, U y) { return functions::isgreaterequal(x, y); }
+		/// Signed 32-bit integers for bulk conversions.
+		/// The upper bound is the largest single-precision value below 2^31, larger values saturate separately.
+		template<> struct bulk_int<int>
+		{
+			static HALF_CONSTEXPR float lower() { return -2147483648.0f; }
+			static HALF_CONSTEXPR float upper() { return 2147483520.0f; }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			static __m128i load(const int *src) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)); }
+			static void store(int *dst, __m128i x) { _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), x); }
+		#endif
+		};
 
-		/// \}
-		/// \name Arithmetic operators
-		/// \{
+		/// Convert single-precision to integer with saturation.
+		/// Values beyond the range of the integer type and infinities saturate to its limits.
+		/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \tparam S `true` for converting NaN to zero, `false` for converting it to the limit of its sign like half2int()
+		/// \tparam T integer type to convert to
+		/// \param value single-precision value
+		/// \return rounded value
+		template<std::float_round_style R,bool E,bool S,typename T> T float2int_saturate(float value)
+		{
+			if(builtin_isnan(value))
+				return S ? T() : builtin_signbit(value) ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+			if(value > bulk_int<T>::upper())
+				return std::numeric_limits<T>::max();
+			if(value < bulk_int<T>::lower())
+				return std::numeric_limits<T>::min();
+			long i = static_cast<long>(value);
+			float f = value - static_cast<float>(i);
+			if(R == std::round_to_nearest)
+			{
+				if(std::abs(f) > 0.5f || (std::abs(f) == 0.5f && (!E || (i&1))))
+					i += (value<0.0f) ? -1 : 1;
+			}
+			else if(R == std::round_toward_infinity)
+				i += f > 0.0f;
+			else if(R == std::round_toward_neg_infinity)
+				i -= f < 0.0f;
+			return static_cast<T>(i);
+		}
 
-		/// Add halfs.
-		/// \param x left operand
-		/// \param y right operand
-		/// \return sum of half expressions
-		template<typename T,typename U> typename enable<expr,T,U>::type operator+(T x, U y) { return functions::plus(x, y); }
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		/// Convert single-precision to integer with saturation using SSE2.
+		/// This computes exactly the same results as float2int_saturate() for all inputs, but for 4 values at once.
+		/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \tparam S `true` for converting NaN to zero, `false` for converting it to the limit of its sign
+		/// \tparam T integer type to convert to
+		/// \param value single-precision values
+		/// \return rounded values in 32-bit lanes
+		template<std::float_round_style R,bool E,bool S,typename T> __m128i float2int_saturate_sse2(__m128 value)
+		{
+			__m128 upper = _mm_set1_ps(bulk_int<T>::upper());
+			__m128 clamped = _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(bulk_int<T>::lower())), upper);
+			__m128i i = _mm_cvttps_epi32(clamped);
+			__m128 f = _mm_sub_ps(clamped, _mm_cvtepi32_ps(i));
+			if(R == std::round_to_nearest)
+			{
+				__m128 af = _mm_andnot_ps(_mm_set1_ps(-0.0f), f), point5 = _mm_set1_ps(0.5f);
+				__m128i tie = _mm_castps_si128(_mm_cmpeq_ps(af, point5));
+				if(E)
+					tie = _mm_and_si128(tie, _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(i, _mm_set1_epi32(1))));
+				__m128i inc = _mm_or_si128(_mm_castps_si128(_mm_cmpgt_ps(af, point5)), tie);
+				i = _mm_add_epi32(i, _mm_and_si128(inc, _mm_or_si128(_mm_srai_epi32(_mm_castps_si128(clamped), 31), _mm_set1_epi32(1))));
+			}
+			else if(R == std::round_toward_infinity)
+				i = _mm_sub_epi32(i, _mm_castps_si128(_mm_cmpgt_ps(f, _mm_setzero_ps())));
+			else if(R == std::round_toward_neg_infinity)
+				i = _mm_add_epi32(i, _mm_castps_si128(_mm_cmplt_ps(f, _mm_setzero_ps())));
+			__m128i limit_max = _mm_set1_epi32(std::numeric_limits<T>::max()), limit_min = _mm_set1_epi32(std::numeric_limits<T>::min());
+			i = select(_mm_castps_si128(_mm_cmpgt_ps(value, upper)), limit_max, i);
+			__m128i nan = _mm_castps_si128(_mm_cmpunord_ps(value, value));
+			return select(nan, S ? _mm_setzero_si128() : select(_mm_srai_epi32(_mm_castps_si128(value), 31), limit_min, limit_max), i);
+		}
+	#endif
+
+		/// Ordered integer key of half-precision value for comparisons.
+		/// Keys of non-NaN halfs compare like their values, with negative zero equal to positive zero.
+		/// \param bits binary representation of half-precision value
+		/// \return key in [-32767, 32767]
+		inline int compare_key(unsigned int bits) { return (bits&0x8000) ? -static_cast<int>(bits&0x7FFF) : static_cast<int>(bits&0x7FFF); }
+
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		/// Ordered integer keys of half-precision values for comparisons using SSE2.
+		/// \param bits binary representations of half-precision values
+		/// \return keys in 16-bit lanes, like compare_key()
+		inline __m128i compare_key(__m128i bits)
+		{
+			__m128i sign = _mm_srai_epi16(bits, 15);
+			return _mm_sub_epi16(_mm_xor_si128(_mm_and_si128(bits, _mm_set1_epi16(0x7FFF)), sign), sign);
+		}
+
+		/// NaN mask of half-precision values using SSE2.
+		/// \param bits binary representations of half-precision values
+		/// \return all bits set in 16-bit lanes of NaNs
+		inline __m128i nan_mask(__m128i bits) { return _mm_cmpgt_epi16(_mm_and_si128(bits, _mm_set1_epi16(0x7FFF)), _mm_set1_epi16(0x7C00)); }
+	#endif
+
+	#if HALF_ENABLE_F16C_INTRINSICS
+		/// Ordered integer keys of half-precision values for comparisons using AVX2.
+		/// \param bits binary representations of half-precision values
+		/// \return keys in 16-bit lanes, like compare_key()
+		inline HALF_TARGET("avx2") __m256i compare_key(__m256i bits)
+		{
+			__m256i sign = _mm256_srai_epi16(bits, 15);
+			return _mm256_sub_epi16(_mm256_xor_si256(_mm256_and_si256(bits, _mm256_set1_epi16(0x7FFF)), sign), sign);
+		}
+
+		/// NaN mask of half-precision values using AVX2.
+		/// \param bits binary representations of half-precision values
+		/// \return all bits set in 16-bit lanes of NaNs
+		inline HALF_TARGET("avx2") __m256i nan_mask(__m256i bits) { return _mm256_cmpgt_epi16(_mm256_and_si256(bits, _mm256_set1_epi16(0x7FFF)), _mm256_set1_epi16(0x7C00)); }
+	#endif
+
+		/// Bitwise absolute value.
+		/// Like all bitwise array operations, this works on the binary representations of halfs, either one at a time or in 
+		/// the 16-bit lanes of SSE2 or AVX2 registers, and ignores its second operand if unary.
+		struct bits_fabs
+		{
+			unsigned int operator()(unsigned int x, unsigned int) const { return x & 0x7FFF; }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			__m128i operator()(__m128i x, __m128i) const { return _mm_and_si128(x, _mm_set1_epi16(0x7FFF)); }
+		#endif
+		#if HALF_ENABLE_F16C_INTRINSICS
+			HALF_TARGET("avx2") __m256i operator()(__m256i x, __m256i) const { return _mm256_and_si256(x, _mm256_set1_epi16(0x7FFF)); }
+		#endif
+		};
+
+		/// Bitwise negation.
+		struct bits_negate
+		{
+			unsigned int operator()(unsigned int x, unsigned int) const { return x ^ 0x8000; }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			__m128i operator()(__m128i x, __m128i) const { return _mm_xor_si128(x, _mm_set1_epi16(-0x8000)); }
+		#endif
+		#if HALF_ENABLE_F16C_INTRINSICS
+			HALF_TARGET("avx2") __m256i operator()(__m256i x, __m256i) const { return _mm256_xor_si256(x, _mm256_set1_epi16(-0x8000)); }
+		#endif
+		};
+
+		/// Bitwise sign composition.
+		struct bits_copysign
+		{
+			unsigned int operator()(unsigned int x, unsigned int y) const { return x ^ ((x^y)&0x8000); }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			__m128i operator()(__m128i x, __m128i y) const
+			{
+				return _mm_xor_si128(x, _mm_and_si128(_mm_xor_si128(x, y), _mm_set1_epi16(-0x8000)));
+			}
+		#endif
+		#if HALF_ENABLE_F16C_INTRINSICS
+			HALF_TARGET("avx2") __m256i operator()(__m256i x, __m256i y) const
+			{
+				return _mm256_xor_si256(x, _mm256_and_si256(_mm256_xor_si256(x, y), _mm256_set1_epi16(-0x8000)));
+			}
+		#endif
+		};
+
+		/// Bitwise minimum or maximum.
+		/// This returns the other operand if one is NaN and the first operand if both compare equal, exactly like 
+		/// binary_specialized<half,half>::fmin() and binary_specialized<half,half>::fmax().
+		/// \tparam M `true` for maximum, `false` for minimum
+		template<bool M> struct bits_extremum
+		{
+			unsigned int operator()(unsigned int x, unsigned int y) const
+			{
+				if((x&0x7FFF) > 0x7C00)
+					return y;
+				if((y&0x7FFF) > 0x7C00)
+					return x;
+				return (M ? (compare_key(x) < compare_key(y)) : (compare_key(x) > compare_key(y))) ? y : x;
+			}
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			__m128i operator()(__m128i x, __m128i y) const
+			{
+				__m128i kx = compare_key(x), ky = compare_key(y);
+				__m128i take = _mm_or_si128(nan_mask(x), _mm_andnot_si128(nan_mask(y), M ? _mm_cmplt_epi16(kx, ky) : _mm_cmpgt_epi16(kx, ky)));
+				return select(take, y, x);
+			}
+		#endif
+		#if HALF_ENABLE_F16C_INTRINSICS
+			HALF_TARGET("avx2") __m256i operator()(__m256i x, __m256i y) const
+			{
+				__m256i kx = compare_key(x), ky = compare_key(y);
+				__m256i take = _mm256_or_si256(nan_mask(x), _mm256_andnot_si256(nan_mask(y), M ? _mm256_cmpgt_epi16(ky, kx) : _mm256_cmpgt_epi16(kx, ky)));
+				return select(take, y, x);
+			}
+		#endif
+		};
+
+		/// Bitwise clamping.
+		/// Like `std::clamp`, this returns the lower bound if smaller than it, the upper bound if greater than it and the 
+		/// value itself otherwise, so NaNs are kept.
+		struct bits_clamp
+		{
+			/// Initialize.
+			/// \param lo binary representation of lower bound
+			/// \param hi binary representation of upper bound
+			bits_clamp(unsigned int lo, unsigned int hi) : lo_(lo), hi_(hi) {}
+
+			unsigned int operator()(unsigned int x, unsigned int) const
+			{
+				if((x&0x7FFF) > 0x7C00)
+					return x;
+				return (compare_key(x) < compare_key(lo_)) ? lo_ : (compare_key(hi_) < compare_key(x)) ? hi_ : x;
+			}
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			__m128i operator()(__m128i x, __m128i) const
+			{
+				__m128i lo = _mm_set1_epi16(static_cast<short>(lo_)), hi = _mm_set1_epi16(static_cast<short>(hi_)), kx = compare_key(x), nan = nan_mask(x);
+				__m128i below = _mm_andnot_si128(nan, _mm_cmplt_epi16(kx, compare_key(lo))), above = _mm_andnot_si128(nan, _mm_cmpgt_epi16(kx, compare_key(hi)));
+				return select(below, lo, select(above, hi, x));
+			}
+		#endif
+		#if HALF_ENABLE_F16C_INTRINSICS
+			HALF_TARGET("avx2") __m256i operator()(__m256i x, __m256i) const
+			{
+				__m256i lo = _mm256_set1_epi16(static_cast<short>(lo_)), hi = _mm256_set1_epi16(static_cast<short>(hi_)), kx = compare_key(x), nan = nan_mask(x);
+				__m256i below = _mm256_andnot_si256(nan, _mm256_cmpgt_epi16(compare_key(lo), kx)), above = _mm256_andnot_si256(nan, _mm256_cmpgt_epi16(kx, compare_key(hi)));
+				return select(below, lo, select(above, hi, x));
+			}
+		#endif
+
+		private:
+			unsigned int lo_;
+			unsigned int hi_;
+		};
+
+		/// Bitwise rectified linear unit.
+		/// This replaces negative values including negative zero by positive zero and keeps NaNs.
+		struct bits_relu
+		{
+			unsigned int operator()(unsigned int x, unsigned int) const { return ((x&0x8000) && (x&0x7FFF) <= 0x7C00) ? 0 : x; }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			__m128i operator()(__m128i x, __m128i) const { return _mm_andnot_si128(_mm_andnot_si128(nan_mask(x), _mm_srai_epi16(x, 15)), x); }
+		#endif
+		#if HALF_ENABLE_F16C_INTRINSICS
+			HALF_TARGET("avx2") __m256i operator()(__m256i x, __m256i) const { return _mm256_andnot_si256(_mm256_andnot_si256(nan_mask(x), _mm256_srai_epi16(x, 15)), x); }
+		#endif
+		};
+
+		/// Bitwise operation with constant second operand.
+		/// \tparam F bitwise binary operation
+		template<typename F> struct bits_bound
+		{
+			/// Initialize.
+			/// \param y binary representation of second operand
+			explicit bits_bound(unsigned int y) : y_(y) {}
+
+			unsigned int operator()(unsigned int x, unsigned int) const { return F()(x, y_); }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			__m128i operator()(__m128i x, __m128i) const { return F()(x, _mm_set1_epi16(static_cast<short>(y_))); }
+		#endif
+		#if HALF_ENABLE_F16C_INTRINSICS
+			HALF_TARGET("avx2") __m256i operator()(__m256i x, __m256i) const { return F()(x, _mm256_set1_epi16(static_cast<short>(y_))); }
+		#endif
+
+		private:
+			unsigned int y_;
+		};
+
+		/// Implementation of bulk conversions.
+		/// The SIMD kernels work on the binary representation of halfs and are thus only used if a half is exactly as large 
+		/// as its underlying 16-bit integer and single-precision is IEEE-conformant, otherwise the scalar conversions are used.
+		/// Operations that can't work on the arrays directly stage blocks of them in small buffers on the stack, which stay 
+		/// in the L1 cache, so that each array is still only passed over once.
+		struct bulk
+		{
+			/// Check if SIMD kernels are applicable.
+			/// \retval true if halfs and floats have plain IEEE representations
+			/// \retval false else
+			static HALF_CONSTEXPR bool simd_layout() { return sizeof(half) == 2 && sizeof(float) == 4 && std::numeric_limits<float>::is_iec559; }
+
+			/// Convert single-precision array to half-precision.
+			/// This uses the hardware conversion whenever it rounds like the requested rounding mode and an exact integer 
+			/// emulation otherwise.
+			/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+			/// \tparam E `true` for round to even, `false` for round away from zero
+			/// \tparam S `true` for saturating overflows to the largest finite value, `false` for overflowing to infinity
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			template<std::float_round_style R,bool E,bool S> static void float2half(const float *src, half *dst, std::size_t n)
+			{
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				if(simd_layout())
+				{
+				#if HALF_ENABLE_F16C_INTRINSICS
+					if((R!=std::round_to_nearest || E) && cpu_supports(cpu_f16c))
+						return float2half_f16c<R,E,S>(src, dst, n);
+					if(cpu_supports(cpu_avx2))
+						return float2half_avx2<R,E,S>(src, dst, n);
+				#endif
+					return float2half_sse2<R,E,S>(src, dst, n);
+				}
+			#endif
+				for(std::size_t i=0; i<n; ++i)
+					dst[i] = half(binary, S ? saturate(detail::float2half<R,E>(src[i]), src[i]) : detail::float2half<R,E>(src[i]));
+			}
+
+			/// Convert half-precision array to single-precision.
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			static void half2float(const half *src, float *dst, std::size_t n)
+			{
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				if(simd_layout())
+				{
+				#if HALF_ENABLE_F16C_INTRINSICS
+					if(cpu_supports(cpu_f16c))
+						return half2float_f16c(src, dst, n);
+				#endif
+					return half2float_sse2(src, dst, n);
+				}
+			#endif
+				for(std::size_t i=0; i<n; ++i)
+					dst[i] = half_caster<float,half>::cast(src[i]);
+			}
+
+			/// Convert double-precision array to half-precision.
+			/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+			/// \tparam E `true` for round to even, `false` for round away from zero
+			/// \tparam S `true` for saturating overflows to the largest finite value, `false` for overflowing to infinity
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			template<std::float_round_style R,bool E,bool S> static void double2half(const double *src, half *dst, std::size_t n)
+			{
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				if(simd_layout() && sizeof(double) == 8 && std::numeric_limits<double>::is_iec559)
+				{
+				#if HALF_ENABLE_F16C_INTRINSICS
+					if((R!=std::round_to_nearest || E) && cpu_supports(cpu_f16c))
+						return double2half_f16c<R,E,S>(src, dst, n);
+					if(cpu_supports(cpu_avx2))
+						return double2half_avx2<R,E,S>(src, dst, n);
+				#endif
+					return double2half_sse2<R,E,S>(src, dst, n);
+				}
+			#endif
+				for(std::size_t i=0; i<n; ++i)
+					dst[i] = half(binary, S ? saturate(detail::float2half<R,E>(src[i]), src[i]) : detail::float2half<R,E>(src[i]));
+			}
+
+			/// Convert half-precision array to double-precision.
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			static void half2double(const half *src, double *dst, std::size_t n)
+			{
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				if(simd_layout() && sizeof(double) == 8 && std::numeric_limits<double>::is_iec559)
+				{
+				#if HALF_ENABLE_F16C_INTRINSICS
+					if(cpu_supports(cpu_f16c))
+						return half2double_f16c(src, dst, n);
+				#endif
+					return half2double_sse2(src, dst, n);
+				}
+			#endif
+				for(std::size_t i=0; i<n; ++i)
+					dst[i] = half_caster<double,half>::cast(src[i]);
+			}
+
+			/// Convert integer array to half-precision.
+			/// This converts blocks of integers to single-precision and converts these like float2half().
+			/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+			/// \tparam E `true` for round to even, `false` for round away from zero
+			/// \tparam S `true` for saturating overflows to the largest finite value, `false` for overflowing to infinity
+			/// \tparam T source type (builtin integer type)
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			/// \param scale factor to multiply values with in single-precision before rounding
+			template<std::float_round_style R,bool E,bool S,typename T> static void int2half(const T *src, half *dst, std::size_t n, float scale)
+			{
+				static const std::size_t block = 256;
+				float buffer[block];
+				for(std::size_t i=0; i<n; i+=block)
+				{
+					std::size_t m = std::min(n-i, block), j = 0;
+				#if HALF_ENABLE_SSE2_INTRINSICS
+					__m128 factor = _mm_set1_ps(scale), limit = _mm_set1_ps(65504.0f);
+					for(; j+4<=m; j+=4)
+					{
+						__m128 value = _mm_mul_ps(_mm_cvtepi32_ps(bulk_int<T>::load(src+i+j)), factor);
+						if(S)
+							value = _mm_min_ps(_mm_max_ps(value, _mm_sub_ps(_mm_setzero_ps(), limit)), limit);
+						_mm_storeu_ps(buffer+j, value);
+					}
+				#endif
+					for(; j<m; ++j)
+					{
+						buffer[j] = static_cast<float>(src[i+j]) * scale;
+						if(S)
+							buffer[j] = std::min(std::max(buffer[j], -65504.0f), 65504.0f);
+					}
+					float2half<R,E,false>(buffer, dst+i, m);
+				}
+			}
+
+			/// Convert half-precision array to integers.
+			/// This converts blocks of halfs to single-precision like half2float() and rounds these to integers.
+			/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+			/// \tparam E `true` for round to even, `false` for round away from zero
+			/// \tparam S `true` for converting NaN to zero, `false` for converting it to the limit of its sign
+			/// \tparam T destination type (builtin integer type)
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			/// \param scale factor to multiply values with in single-precision before rounding
+			template<std::float_round_style R,bool E,bool S,typename T> static void half2int(const half *src, T *dst, std::size_t n, float scale)
+			{
+				static const std::size_t block = 256;
+				float buffer[block];
+				for(std::size_t i=0; i<n; i+=block)
+				{
+					std::size_t m = std::min(n-i, block), j = 0;
+					half2float(src+i, buffer, m);
+				#if HALF_ENABLE_SSE2_INTRINSICS
+					__m128 factor = _mm_set1_ps(scale);
+					for(; j+4<=m; j+=4)
+						bulk_int<T>::store(dst+i+j, float2int_saturate_sse2<R,E,S,T>(_mm_mul_ps(_mm_loadu_ps(buffer+j), factor)));
+				#endif
+					for(; j<m; ++j)
+						dst[i+j] = float2int_saturate<R,E,S,T>(buffer[j]*scale);
+				}
+			}
+
+			/// Convert single-precision array to half-precision and collect statistics.
+			/// This converts blocks of floats like float2half() and examines each block's sources together with its results.
+			/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+			/// \tparam E `true` for round to even, `false` for round away from zero
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			/// \param stats statistics to add to
+			template<std::float_round_style R,bool E> static void float2half_stats(const float *src, half *dst, std::size_t n, conversion_stats &stats)
+			{
+				static const std::size_t block = 256;
+				for(std::size_t i=0; i<n; i+=block)
+				{
+					std::size_t m = std::min(n-i, block), j = 0;
+					float2half<R,E,false>(src+i, dst+i, m);
+				#if HALF_ENABLE_SSE2_INTRINSICS
+					if(simd_layout())
+					{
+					#if HALF_ENABLE_F16C_INTRINSICS
+						if(cpu_supports(cpu_f16c))
+							j = stats_f16c(src+i, dst+i, m, stats);
+						else
+					#endif
+						j = stats_sse2(src+i, dst+i, m, stats);
+					}
+				#endif
+					for(; j<m; ++j)
+					{
+						float value = src[i+j];
+						unsigned int habs = dst[i+j].data_ & 0x7FFF;
+						if(value != value)
+							++stats.nan;
+						else if(habs == 0x7C00)
+							stats.overflow += std::abs(value) <= std::numeric_limits<float>::max();
+						else if(value != 0.0f)
+						{
+							stats.underflow += habs == 0;
+							stats.subnormal += habs != 0 && habs < 0x400;
+							stats.max_error = std::max(stats.max_error, std::abs(detail::half2float<float>(dst[i+j].data_)-value)/std::abs(value));
+						}
+					}
+				}
+			}
+
+			/// Cast to half-precision with saturation.
+			/// \tparam R rounding mode to use
+			/// \tparam U source type (builtin arithmetic type)
+			/// \param arg value to cast
+			/// \return \a arg rounded to half-precision, with finite overflows replaced by the largest finite value
+			template<std::float_round_style R,typename U> static half saturate_cast(U arg)
+			{
+				uint16 bits = half_caster<half,U,R>::cast(arg).data_;
+				return half(binary, std::numeric_limits<U>::is_integer ? static_cast<uint16>(bits-((bits&0x7FFF)==0x7C00)) : saturate(bits, arg));
+			}
+
+			/// Convert single-precision value to half-precision with stochastic rounding.
+			/// \param value single-precision value
+			/// \param seed seed of random number generator
+			/// \param counter counter of random number to use
+			/// \return rounded value
+			static half float2half_stochastic(float value, unsigned long seed, std::size_t counter)
+			{
+				return half(binary, detail::float2half_stochastic(value, random_key(seed, counter)(counter&0xFFFFFFFF)));
+			}
+
+			/// Convert single-precision array to half-precision with stochastic rounding.
+			/// Each element is rounded using the random number for the counter of the first element plus its index, so the 
+			/// results don't depend on how the array is split into parts. The random numbers are computed in SIMD registers 
+			/// alongside the conversion.
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			/// \param seed seed of random number generator
+			/// \param counter counter of random number to use for first element
+			static void float2half_stochastic(const float *src, half *dst, std::size_t n, unsigned long seed, std::size_t counter)
+			{
+				typedef bits<float>::type uint32;
+				for(std::size_t i=0; i<n; )
+				{
+					std::size_t c = counter + i, m = n - i, j = 0;
+					if(sizeof(std::size_t) > 4)
+						m = std::min(m, static_cast<std::size_t>(0xFFFFFFFF-(c&0xFFFFFFFF))+1);
+					random_key key(seed, c);
+					uint32 base = static_cast<uint32>(c&0xFFFFFFFF);
+				#if HALF_ENABLE_SSE2_INTRINSICS
+					if(simd_layout())
+					{
+						__m128i k1 = _mm_set1_epi32(static_cast<int>(key.k1)), k2 = _mm_set1_epi32(static_cast<int>(key.k2)), four = _mm_set1_epi32(4);
+						__m128i ctr = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(base)), _mm_setr_epi32(0, 1, 2, 3));
+						for(; j+8<=m; j+=8)
+						{
+							__m128i r0 = mix32_sse2(_mm_add_epi32(mix32_sse2(_mm_xor_si128(ctr, k1)), k2));
+							ctr = _mm_add_epi32(ctr, four);
+							__m128i r1 = mix32_sse2(_mm_add_epi32(mix32_sse2(_mm_xor_si128(ctr, k1)), k2));
+							ctr = _mm_add_epi32(ctr, four);
+							_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i+j), pack_halfs(float2half_stochastic_sse2(_mm_loadu_ps(src+i+j), r0), 
+								float2half_stochastic_sse2(_mm_loadu_ps(src+i+j+4), r1)));
+						}
+					}
+				#endif
+					for(; j<m; ++j)
+						dst[i+j] = half(binary, detail::float2half_stochastic(src[i+j], key(static_cast<uint32>(base+j))));
+					i += m;
+				}
+			}
+
+			/// Evaluate mathematical function for half-precision array.
+			/// This converts blocks of halfs to single-precision and evaluates the function's SIMD kernel on them. 
+			/// Each result is rounded to half-precision together with its bounds given by the kernel's relative error, 
+			/// and if these round differently, the result is too close to a rounding boundary and is recomputed from 
+			/// the double-precision reference, as are all arguments the kernel does not handle. So the results are 
+			/// exactly the correctly rounded double-precision function values, computed in the SIMD kernel for nearly 
+			/// all arguments. The roundings use the hardware conversion if available.
+			/// \tparam F function to evaluate
+			/// \tparam R rounding mode to use
+			/// \tparam E `true` for round to even, `false` for round away from zero
+			/// \param src source array
+			/// \param dst destination array, may be equal to \a src
+			/// \param n number of elements
+			template<typename F,std::float_round_style R,bool E> static void math(const half *src, half *dst, std::size_t n)
+			{
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				if(simd_layout())
+				{
+					static const std::size_t block = 256;
+					float in[block], value[3][block];
+					uint16 out[3][block];
+					unsigned char special[block/4];
+					__m128 error = _mm_set1_ps(F::error()), abs = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)), max = _mm_set1_ps(std::numeric_limits<float>::max());
+					for(std::size_t i=0; i<n; i+=block)
+					{
+						std::size_t m = std::min(n-i, block), k = (m+7) & ~static_cast<std::size_t>(7);
+						half2float(src+i, in, m);
+						std::fill(in+m, in+k, 0.0f);
+						for(std::size_t j=0; j<k; j+=4)
+						{
+							__m128 x = _mm_loadu_ps(in+j), y = F::eval(x), d = _mm_mul_ps(_mm_min_ps(_mm_and_ps(y, abs), max), error);
+							_mm_storeu_ps(value[0]+j, y);
+							_mm_storeu_ps(value[1]+j, _mm_sub_ps(y, d));
+							_mm_storeu_ps(value[2]+j, _mm_add_ps(y, d));
+							special[j/4] = static_cast<unsigned char>(_mm_movemask_ps(F::special(x)));
+						}
+						for(int r=0; r<3; ++r)
+							float2half<R,E,false>(value[r], reinterpret_cast<half*>(out[r]), k);
+						for(std::size_t j=0; j<m; j+=8)
+						{
+							__m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(out[0]+j));
+							__m128i same = _mm_and_si128(_mm_cmpeq_epi16(h, _mm_loadu_si128(reinterpret_cast<const __m128i*>(out[1]+j))), 
+								_mm_cmpeq_epi16(h, _mm_loadu_si128(reinterpret_cast<const __m128i*>(out[2]+j))));
+							unsigned int hard = (~_mm_movemask_epi8(_mm_packs_epi16(same, same))&0xFF) | special[j/4] | (special[j/4+1]<<4);
+							for(std::size_t l=j; hard && l<m; ++l, hard>>=1)
+								if(hard & 1)
+									out[0][l] = detail::float2half<R,E>(F::reference(in[l]));
+						}
+						std::memcpy(dst+i, out[0], m*sizeof(uint16));
+					}
+					return;
+				}
+			#endif
+				for(std::size_t i=0; i<n; ++i)
+					dst[i] = half(binary, detail::float2half<R,E>(F::reference(detail::half2float<double>(src[i].data_))));
+			}
+
+			/// Dot product of half-precision arrays.
+			/// Since products of halfs are exact in single-precision, the result only depends on the accumulation, which uses 
+			/// several partial sums and may thus differ slightly from a sequential summation.
+			/// \tparam T type to accumulate in, `float` or `double`
+			/// \param x first array
+			/// \param y second array
+			/// \param n number of elements
+			/// \return sum of products
+			template<typename T> static T dot(const half *x, const half *y, std::size_t n)
+			{
+			#if HALF_ENABLE_F16C_INTRINSICS
+				if(simd_layout() && cpu_supports(cpu_f16c))
+					return dot_f16c(x, y, n, T());
+			#endif
+				static const std::size_t block = 256;
+				float a[block], b[block];
+				T sum[4] = { T(), T(), T(), T() };
+				for(std::size_t i=0; i<n; i+=block)
+				{
+					std::size_t m = std::min(n-i, block);
+					half2float(x+i, a, m);
+					half2float(y+i, b, m);
+					for(std::size_t j=0; j<m; ++j)
+						sum[j&3] += static_cast<T>(a[j]*b[j]);
+				}
+				return (sum[0]+sum[1]) + (sum[2]+sum[3]);
+			}
+
+			/// Dot product of half-precision and single-precision arrays.
+			/// This accumulates exactly like the half-precision version and thus gives the same result as that for the 
+			/// half-precision values \a y was converted from.
+			/// \tparam T type to accumulate in, `float` or `double`
+			/// \param x half-precision array
+			/// \param y single-precision array
+			/// \param n number of elements
+			/// \return sum of products
+			template<typename T> static T dot(const half *x, const float *y, std::size_t n)
+			{
+			#if HALF_ENABLE_F16C_INTRINSICS
+				if(simd_layout() && cpu_supports(cpu_f16c))
+					return dot_f16c(x, y, n, T());
+			#endif
+				static const std::size_t block = 256;
+				float a[block];
+				T sum[4] = { T(), T(), T(), T() };
+				for(std::size_t i=0; i<n; i+=block)
+				{
+					std::size_t m = std::min(n-i, block);
+					half2float(x+i, a, m);
+					for(std::size_t j=0; j<m; ++j)
+						sum[j&3] += static_cast<T>(a[j]*y[i+j]);
+				}
+				return (sum[0]+sum[1]) + (sum[2]+sum[3]);
+			}
+
+			/// Scaled addition of half-precision arrays.
+			/// This converts blocks of both arrays to single-precision and rounds each result only once.
+			/// \tparam R rounding mode to use
+			/// \tparam E `true` for round to even, `false` for round away from zero
+			/// \param alpha factor for \a x
+			/// \param x array to add
+			/// \param y array to add to, may be equal to \a x
+			/// \param n number of elements
+			template<std::float_round_style R,bool E> static void axpy(float alpha, const half *x, half *y, std::size_t n)
+			{
+				static const std::size_t block = 256;
+				float a[block], b[block];
+				for(std::size_t i=0; i<n; i+=block)
+				{
+					std::size_t m = std::min(n-i, block), j = 0;
+					half2float(x+i, a, m);
+					half2float(y+i, b, m);
+				#if HALF_ENABLE_SSE2_INTRINSICS
+					for(__m128 s=_mm_set1_ps(alpha); j+4<=m; j+=4)
+						_mm_storeu_ps(b+j, _mm_add_ps(_mm_mul_ps(s, _mm_loadu_ps(a+j)), _mm_loadu_ps(b+j)));
+				#endif
+					for(; j<m; ++j)
+						b[j] = alpha*a[j] + b[j];
+					float2half<R,E,false>(b, y+i, m);
+				}
+			}
+
+			/// Product of half-precision matrix and single-precision vector.
+			/// Each result is accumulated like dot() and rounded only once. If \a beta is zero, the destination isn't read.
+			/// \tparam T type to accumulate in, `float` or `double`
+			/// \tparam R rounding mode to use
+			/// \tparam E `true` for round to even, `false` for round away from zero
+			/// \param m number of rows
+			/// \param n number of columns
+			/// \param alpha factor for matrix-vector product
+			/// \param a row-major matrix
+			/// \param lda distance between rows of \a a in elements
+			/// \param x vector of \a n elements to multiply with
+			/// \param beta factor for \a y
+			/// \param y vector of \a m elements to add to and store results into, must not overlap \a a
+			template<typename T,std::float_round_style R,bool E> static void gemv(std::size_t m, std::size_t n, T alpha, const half *a, std::size_t lda, 
+				const float *x, T beta, half *y)
+			{
+				for(std::size_t i=0; i<m; ++i)
+				{
+					T value = alpha * dot<T>(a+i*lda, x, n);
+					if(beta != T())
+						value += beta * detail::half2float<T>(y[i].data_);
+					y[i].data_ = detail::float2half<R,E>(value);
+				}
+			}
+
+			/// Find extremum of half-precision array.
+			/// Values are compared by their ordered integer keys, making negative zero smaller than positive zero. NaNs are 
+			/// ignored.
+			/// \tparam M `true` for maximum, `false` for minimum
+			/// \param data array to search
+			/// \param n number of elements
+			/// \param key variable to store key of extremum into, `INT_MIN` or `INT_MAX` if there are only NaNs
+			/// \return index of first extremum, \a n if there are only NaNs
+			template<bool M> static std::size_t extremum(const half *data, std::size_t n, int &key)
+			{
+				int best = M ? INT_MIN : INT_MAX;
+				std::size_t i = 0;
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				if(simd_layout() && n >= 8)
+				{
+					__m128i acc = _mm_set1_epi16(M ? -0x8000 : 0x7FFF);
+					for(; i+8<=n; i+=8)
+					{
+						__m128i k = keys_sse2<M>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data+i)));
+						acc = M ? _mm_max_epi16(acc, k) : _mm_min_epi16(acc, k);
+					}
+					short lanes[8];
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+					for(int j=0; j<8; ++j)
+						if(lanes[j] != (M ? -0x8000 : 0x7FFF) && (M ? (lanes[j] > best) : (lanes[j] < best)))
+							best = lanes[j];
+				}
+			#endif
+				for(; i<n; ++i)
+				{
+					int k = order_key(data[i].data_);
+					if((data[i].data_&0x7FFF) <= 0x7C00 && (M ? (k > best) : (k < best)))
+						best = k;
+				}
+				key = best;
+				if(best == (M ? INT_MIN : INT_MAX))
+					return n;
+				i = 0;
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				if(simd_layout())
+					for(__m128i b=_mm_set1_epi16(static_cast<short>(best)); i+8<=n; i+=8)
+						if(_mm_movemask_epi8(_mm_cmpeq_epi16(keys_sse2<M>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data+i))), b)))
+							break;
+			#endif
+				for(; order_key(data[i].data_) != best || (data[i].data_&0x7FFF) > 0x7C00; ++i) ;
+				return i;
+			}
+
+			/// Ordered integer key of half-precision value.
+			/// Keys of non-NaN halfs compare like their values, with negative zero smaller than positive zero.
+			/// \param bits binary representation of half-precision value
+			/// \return key in [-32768, 32767]
+			static int order_key(uint16 bits) { return (bits&0x8000) ? -1-static_cast<int>(bits&0x7FFF) : static_cast<int>(bits); }
+
+			/// Half-precision value of ordered integer key.
+			/// \param key ordered integer key
+			/// \return half-precision value
+			static half from_key(int key) { return half(binary, static_cast<uint16>((key<0) ? ((-1-key)|0x8000) : key)); }
+
+			/// Sum significands of half-precision array by exponent.
+			/// All halfs with the same sign and exponent are multiples of the same power of two, so their exact sum only 
+			/// needs integer additions of their significands. Consecutive elements go to 4 different sets of sums, so 
+			/// additions to the same sum don't depend on each other.
+			/// \param data array to sum
+			/// \param n number of elements, at most 2^24
+			/// \param sums 4 sets of 64 sums indexed by sign and exponent field, to add the number of values times 2^32 
+			/// plus the sum of their trailing significand bits to
+			static void exponent_sums(const half *data, std::size_t n, bits<double>::type *sums)
+			{
+				typedef bits<double>::type uint64;
+				const uint64 one = static_cast<uint64>(1) << 32;
+				std::size_t i = 0;
+				for(; i+4<=n; i+=4)
+				{
+					unsigned int a = data[i].data_, b = data[i+1].data_, c = data[i+2].data_, d = data[i+3].data_;
+					sums[a>>10] += one | (a&0x3FF);
+					sums[64+(b>>10)] += one | (b&0x3FF);
+					sums[128+(c>>10)] += one | (c&0x3FF);
+					sums[192+(d>>10)] += one | (d&0x3FF);
+				}
+				for(; i<n; ++i)
+					sums[data[i].data_>>10] += one | (data[i].data_&0x3FF);
+			}
+
+			/// Sum products of half-precision arrays by exponent.
+			/// Products of finite halfs are products of their integral significands times a power of two depending only 
+			/// on the sum of their exponents, so their exact sum only needs integer multiplications and additions. Like 
+			/// in exponent_sums(), consecutive products go to 4 different sets of sums. With SSE2 the products and sum 
+			/// indices of 8 elements are computed at once.
+			/// \param x first array
+			/// \param y second array
+			/// \param n number of elements, at most 2^24
+			/// \param sums 4 sets of 128 sums indexed by sign and sum of effective exponents, to add products of 
+			/// significands to
+			/// \return bit mask of non-finite products, 1 for positive infinity, 2 for negative infinity and 4 for NaN
+			static unsigned int exponent_products(const half *x, const half *y, std::size_t n, bits<double>::type *sums)
+			{
+				unsigned int special = 0;
+				std::size_t i = 0;
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				if(simd_layout())
+				{
+					const __m128i exponent = _mm_set1_epi16(0x7C00), fraction = _mm_set1_epi16(0x3FF), hidden = _mm_set1_epi16(0x400);
+					const __m128i sign = _mm_set1_epi16(0x40), sets = _mm_setr_epi16(0, 128, 256, 384, 0, 128, 256, 384);
+					bits<float>::type products[8];
+					uint16 indices[8];
+					for(; i+8<=n; i+=8)
+					{
+						__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i));
+						__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y+i));
+						__m128i ea = _mm_and_si128(a, exponent), eb = _mm_and_si128(b, exponent);
+						if(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(ea, exponent), _mm_cmpeq_epi16(eb, exponent))))
+						{
+							for(unsigned int j=0; j<8; ++j)
+								special |= exponent_product(x[i+j].data_, y[i+j].data_, j&3, sums);
+							continue;
+						}
+						__m128i da = _mm_cmpeq_epi16(ea, _mm_setzero_si128()), db = _mm_cmpeq_epi16(eb, _mm_setzero_si128());
+						__m128i ma = _mm_or_si128(_mm_and_si128(a, fraction), _mm_andnot_si128(da, hidden));
+						__m128i mb = _mm_or_si128(_mm_and_si128(b, fraction), _mm_andnot_si128(db, hidden));
+						__m128i lo = _mm_mullo_epi16(ma, mb), hi = _mm_mulhi_epu16(ma, mb);
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(products), _mm_unpacklo_epi16(lo, hi));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(products+4), _mm_unpackhi_epi16(lo, hi));
+						__m128i e = _mm_sub_epi16(_mm_add_epi16(_mm_srli_epi16(ea, 10), _mm_srli_epi16(eb, 10)), _mm_add_epi16(da, db));
+						e = _mm_or_si128(e, _mm_and_si128(_mm_srli_epi16(_mm_xor_si128(a, b), 9), sign));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(indices), _mm_add_epi16(e, sets));
+						for(unsigned int j=0; j<8; ++j)
+							sums[indices[j]] += products[j];
+					}
+				}
+			#endif
+				for(; i<n; ++i)
+					special |= exponent_product(x[i].data_, y[i].data_, i&3, sums);
+				return special;
+			}
+
+			/// Add product of half-precision values to sum by exponent.
+			/// \param a binary representation of first factor
+			/// \param b binary representation of second factor
+			/// \param set set of sums to use
+			/// \param sums 4 sets of 128 sums indexed by sign and sum of effective exponents
+			/// \return bit mask of non-finite product, 1 for positive infinity, 2 for negative infinity and 4 for NaN
+			static unsigned int exponent_product(unsigned int a, unsigned int b, std::size_t set, bits<double>::type *sums)
+			{
+				unsigned int ea = (a>>10) & 0x1F, eb = (b>>10) & 0x1F;
+				if(ea == 0x1F || eb == 0x1F)
+					return ((a&0x7FFF) > 0x7C00 || (b&0x7FFF) > 0x7C00 || !(a&0x7FFF) || !(b&0x7FFF)) ? 4 : ((a^b)&0x8000) ? 2 : 1;
+				bits<float>::type p = static_cast<bits<float>::type>((a&0x3FF)|((ea!=0)<<10)) * ((b&0x3FF)|((eb!=0)<<10));
+				sums[(set<<7)|(((a^b)&0x8000)>>9)|(ea+eb+(ea==0)+(eb==0))] += p;
+				return 0;
+			}
+
+			/// Apply bitwise operation to half-precision arrays.
+			/// This works directly on the binary representations, 16 or 32 at once with AVX2 or 8 at once with SSE2.
+			/// \tparam F bitwise operation
+			/// \param x first operand array
+			/// \param y second operand array, equal to \a x for unary operations
+			/// \param dst destination array, may be equal to \a x or \a y
+			/// \param n number of elements
+			/// \param f operation to apply
+			template<typename F> static void bitwise(const half *x, const half *y, half *dst, std::size_t n, F f)
+			{
+				std::size_t i = 0;
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				if(simd_layout())
+				{
+				#if HALF_ENABLE_F16C_INTRINSICS
+					if(cpu_supports(cpu_avx2))
+						i = bitwise_avx2(x, y, dst, n, f);
+				#endif
+					for(; i+8<=n; i+=8)
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), f(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i)), 
+							_mm_loadu_si128(reinterpret_cast<const __m128i*>(y+i))));
+					if(i < n)
+					{
+						uint16 a[8] = { 0 }, b[8] = { 0 };
+						std::memcpy(a, x+i, (n-i)*sizeof(uint16));
+						std::memcpy(b, y+i, (n-i)*sizeof(uint16));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(a), f(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a)), 
+							_mm_loadu_si128(reinterpret_cast<const __m128i*>(b))));
+						std::memcpy(dst+i, a, (n-i)*sizeof(uint16));
+					}
+					return;
+				}
+			#endif
+				for(; i<n; ++i)
+					dst[i].data_ = static_cast<uint16>(f(x[i].data_, y[i].data_));
+			}
+
+			/// Apply bitwise operation with constant second operand to half-precision array.
+			/// \tparam F bitwise binary operation
+			/// \param x first operand array
+			/// \param y second operand
+			/// \param dst destination array, may be equal to \a x
+			/// \param n number of elements
+			template<typename F> static void bitwise(const half *x, half y, half *dst, std::size_t n) { bitwise(x, x, dst, n, bits_bound<F>(y.data_)); }
+
+			/// Clamp half-precision array.
+			/// \param src source array
+			/// \param lo lower bound
+			/// \param hi upper bound
+			/// \param dst destination array, may be equal to \a src
+			/// \param n number of elements
+			static void clamp(const half *src, half lo, half hi, half *dst, std::size_t n) { bitwise(src, src, dst, n, bits_clamp(lo.data_, hi.data_)); }
+
+			/// Convert half-precision array to sort keys.
+			/// Sort keys are unsigned integers ordered like the values, with negative zero before positive zero and all NaNs 
+			/// after positive infinity, first the positive ones in ascending and then the negative ones in descending order 
+			/// of their payloads. Every binary representation has a unique key, so keys can be converted back exactly.
+			/// \param src source array
+			/// \param keys array to store keys into
+			/// \param n number of elements
+			/// \param descending `true` for keys ordered in descending order of values, `false` for ascending order
+			static void sort_keys(const half *src, uint16 *keys, std::size_t n, bool descending = false)
+			{
+				unsigned int flip = descending ? 0xFFFF : 0;
+				for(std::size_t i=0; i<n; ++i)
+				{
+					unsigned int bits = src[i].data_;
+					keys[i] = static_cast<uint16>((((bits^((bits>>15) ? 0xFFFF : 0x8000))-0x3FF)^flip) & 0xFFFF);
+				}
+			}
+
+			/// Convert sort keys back to half-precision array.
+			/// \param keys array of ascending sort keys as created by sort_keys()
+			/// \param dst destination array
+			/// \param n number of elements
+			static void sort_values(const uint16 *keys, half *dst, std::size_t n)
+			{
+				for(std::size_t i=0; i<n; ++i)
+				{
+					unsigned int key = (keys[i]+0x3FF) & 0xFFFF;
+					dst[i].data_ = static_cast<uint16>(key^((key>>15) ? 0x8000 : 0xFFFF));
+				}
+			}
+
+			/// Count half-precision values by sort key.
+			/// \param data array to count
+			/// \param n number of elements
+			/// \param counts array of 65536 counters indexed by the keys of sort_keys() to increment
+			static void histogram(const half *data, std::size_t n, std::size_t *counts)
+			{
+				static const std::size_t block = 256;
+				uint16 keys[block];
+				for(std::size_t i=0; i<n; i+=block)
+				{
+					std::size_t m = std::min(n-i, block);
+					sort_keys(data+i, keys, m);
+					for(std::size_t j=0; j<m; ++j)
+						++counts[keys[j]];
+				}
+			}
+
+			/// Access threshold for streaming conversions.
+			/// With thread support this is atomic, since parallel conversions read it from the pool's threads.
+			/// \return minimum number of destination bytes for using non-temporal stores
+		#if HALF_ENABLE_CPP11_THREAD
+			static std::atomic<std::size_t>& streaming_threshold()
+			{
+				static std::atomic<std::size_t> threshold(HALF_STREAMING_THRESHOLD);
+				return threshold;
+			}
+		#else
+			static std::size_t& streaming_threshold()
+			{
+				static std::size_t threshold = HALF_STREAMING_THRESHOLD;
+				return threshold;
+			}
+		#endif
+
+			/// Check if conversion should use non-temporal stores.
+			/// \param bytes size of destination array in bytes
+			/// \retval true if streaming stores available and destination large enough
+			/// \retval false else
+			static bool streaming(std::size_t bytes)
+			{
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				return simd_layout() && bytes >= streaming_threshold();
+			#else
+				static_cast<void>(bytes);
+				return false;
+			#endif
+			}
+
+			/// Run bulk conversion.
+			/// This streams the results into the destination if it is larger than the streaming threshold.
+			/// \tparam T source type
+			/// \tparam U destination type
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			/// \param kernel conversion to use
+			template<typename T,typename U> static void run(const T *src, U *dst, std::size_t n, void (*kernel)(const T*,U*,std::size_t))
+			{
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				if(streaming(n*sizeof(U)))
+					return stream(src, dst, n, kernel);
+			#endif
+				kernel(src, dst, n);
+			}
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Ordered integer keys of 8 half-precision values using SSE2.
+			/// \tparam M `true` for replacing NaNs with the smallest key, `false` for replacing them with the largest key
+			/// \param bits binary representations of half-precision values
+			/// \return ordered keys like order_key() for non-NaN values
+			template<bool M> static __m128i keys_sse2(__m128i bits)
+			{
+				__m128i key = _mm_xor_si128(bits, _mm_and_si128(_mm_srai_epi16(bits, 15), _mm_set1_epi16(0x7FFF)));
+				__m128i nan = _mm_cmpgt_epi16(_mm_and_si128(bits, _mm_set1_epi16(0x7FFF)), _mm_set1_epi16(0x7C00));
+				return select(nan, _mm_set1_epi16(M ? -0x8000 : 0x7FFF), key);
+			}
+
+			/// Run bulk conversion with non-temporal stores.
+			/// This converts blocks of the source array into a buffer and streams it into the destination, while prefetching 
+			/// the next block of the source array.
+			/// \tparam T source type
+			/// \tparam U destination type
+			/// \param src source array
+			/// \param dst destination array, must be aligned to its element size
+			/// \param n number of elements
+			/// \param kernel conversion to use
+			template<typename T,typename U> static void stream(const T *src, U *dst, std::size_t n, void (*kernel)(const T*,U*,std::size_t))
+			{
+				static const std::size_t block = 4096 / sizeof(U), lines = block * sizeof(T) / 64;
+				__m128i buffer[4096/sizeof(__m128i)];
+				std::size_t i = std::min(((16-reinterpret_cast<std::size_t>(dst))&15)/sizeof(U), n);
+				kernel(src, dst, i);
+				for(; i+block<=n; i+=block)
+				{
+					if(i+2*block <= n)
+						for(std::size_t j=0; j<lines; ++j)
+							_mm_prefetch(reinterpret_cast<const char*>(src+i+block)+64*j, _MM_HINT_T0);
+					kernel(src+i, reinterpret_cast<U*>(buffer), block);
+					__m128i *out = reinterpret_cast<__m128i*>(dst+i);
+					for(std::size_t j=0; j<sizeof(buffer)/sizeof(__m128i); j+=4)
+					{
+						_mm_stream_si128(out+j, buffer[j]);
+						_mm_stream_si128(out+j+1, buffer[j+1]);
+						_mm_stream_si128(out+j+2, buffer[j+2]);
+						_mm_stream_si128(out+j+3, buffer[j+3]);
+					}
+				}
+				_mm_sfence();
+				kernel(src+i, dst+i, n-i);
+			}
+		#endif
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Convert single-precision array to half-precision using SSE2.
+			/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+			/// \tparam E `true` for round to even, `false` for round away from zero
+			/// \tparam S `true` for saturating overflows to the largest finite value, `false` for overflowing to infinity
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			template<std::float_round_style R,bool E,bool S> static void float2half_sse2(const float *src, half *dst, std::size_t n)
+			{
+				std::size_t i = 0;
+				for(; i+8<=n; i+=8)
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), pack_halfs(
+						detail::float2half_sse2<R,E,S>(_mm_loadu_ps(src+i)), detail::float2half_sse2<R,E,S>(_mm_loadu_ps(src+i+4))));
+				if(i < n)
+				{
+					float in[8] = { 0.0f };
+					uint16 out[8];
+					std::memcpy(in, src+i, (n-i)*sizeof(float));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out), pack_halfs(
+						detail::float2half_sse2<R,E,S>(_mm_loadu_ps(in)), detail::float2half_sse2<R,E,S>(_mm_loadu_ps(in+4))));
+					std::memcpy(dst+i, out, (n-i)*sizeof(uint16));
+				}
+			}
+		#endif
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Convert 8 half-precision values to single-precision using SSE2.
+			/// \param src binary representations of half-precision values
+			/// \param dst address to store 8 single-precision values at
+			static void half2float_sse2(__m128i src, float *dst)
+			{
+				__m128i zero = _mm_setzero_si128();
+				_mm_storeu_ps(dst, detail::half2float_sse2(_mm_unpacklo_epi16(src, zero)));
+				_mm_storeu_ps(dst+4, detail::half2float_sse2(_mm_unpackhi_epi16(src, zero)));
+			}
+
+			/// Convert half-precision array to single-precision using SSE2.
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			static void half2float_sse2(const half *src, float *dst, std::size_t n)
+			{
+				std::size_t i = 0;
+				for(; i+8<=n; i+=8)
+					half2float_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src+i)), dst+i);
+				if(i < n)
+				{
+					uint16 in[8] = { 0 };
+					float out[8];
+					std::memcpy(in, src+i, (n-i)*sizeof(uint16));
+					half2float_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)), out);
+					std::memcpy(dst+i, out, (n-i)*sizeof(float));
+				}
+			}
+		#endif
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Convert double-precision array to half-precision using SSE2.
+			/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+			/// \tparam E `true` for round to even, `false` for round away from zero
+			/// \tparam S `true` for saturating overflows to the largest finite value, `false` for overflowing to infinity
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			template<std::float_round_style R,bool E,bool S> static void double2half_sse2(const double *src, half *dst, std::size_t n)
+			{
+				std::size_t i = 0;
+				for(; i+8<=n; i+=8)
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), pack_halfs(
+						detail::float2half_sse2<R,E,S>(double2float_sse2(_mm_loadu_pd(src+i), _mm_loadu_pd(src+i+2))), 
+						detail::float2half_sse2<R,E,S>(double2float_sse2(_mm_loadu_pd(src+i+4), _mm_loadu_pd(src+i+6)))));
+				if(i < n)
+				{
+					double in[8] = { 0.0 };
+					uint16 out[8];
+					std::memcpy(in, src+i, (n-i)*sizeof(double));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out), pack_halfs(
+						detail::float2half_sse2<R,E,S>(double2float_sse2(_mm_loadu_pd(in), _mm_loadu_pd(in+2))), 
+						detail::float2half_sse2<R,E,S>(double2float_sse2(_mm_loadu_pd(in+4), _mm_loadu_pd(in+6)))));
+					std::memcpy(dst+i, out, (n-i)*sizeof(uint16));
+				}
+			}
+
+			/// Convert 8 half-precision values to double-precision using SSE2.
+			/// \param src binary representations of half-precision values
+			/// \param dst address to store 8 double-precision values at
+			static void half2double_sse2(__m128i src, double *dst)
+			{
+				__m128i zero = _mm_setzero_si128();
+				detail::half2double_sse2(_mm_unpacklo_epi16(src, zero), dst);
+				detail::half2double_sse2(_mm_unpackhi_epi16(src, zero), dst+4);
+			}
+
+			/// Convert half-precision array to double-precision using SSE2.
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			static void half2double_sse2(const half *src, double *dst, std::size_t n)
+			{
+				std::size_t i = 0;
+				for(; i+8<=n; i+=8)
+					half2double_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src+i)), dst+i);
+				if(i < n)
+				{
+					uint16 in[8] = { 0 };
+					double out[8];
+					std::memcpy(in, src+i, (n-i)*sizeof(uint16));
+					half2double_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)), out);
+					std::memcpy(dst+i, out, (n-i)*sizeof(double));
+				}
+			}
+		#endif
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Collect statistics of conversion to half-precision using SSE2.
+			/// \param src single-precision source values
+			/// \param dst converted half-precision values
+			/// \param n number of elements
+			/// \param stats statistics to add to
+			/// \return number of elements examined, a multiple of 4
+			static std::size_t stats_sse2(const float *src, const half *dst, std::size_t n, conversion_stats &stats)
+			{
+				__m128i zero = _mm_setzero_si128(), ovf = zero, unf = zero, sub = zero, nan = zero;
+				__m128 error = _mm_setzero_ps();
+				std::size_t j = 0;
+				for(; j+4<=n; j+=4)
+				{
+					__m128 value = _mm_loadu_ps(src+j);
+					__m128i hbits = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(dst+j)), zero);
+					__m128i abs = _mm_and_si128(_mm_castps_si128(value), _mm_set1_epi32(0x7FFFFFFF));
+					__m128i habs = _mm_and_si128(hbits, _mm_set1_epi32(0x7FFF));
+					__m128i finite = _mm_cmplt_epi32(abs, _mm_set1_epi32(0x7F800000));
+					__m128i inf = _mm_cmpeq_epi32(habs, _mm_set1_epi32(0x7C00)), null = _mm_cmpeq_epi32(abs, zero);
+					ovf = _mm_sub_epi32(ovf, _mm_and_si128(finite, inf));
+					unf = _mm_sub_epi32(unf, _mm_andnot_si128(null, _mm_cmpeq_epi32(habs, zero)));
+					sub = _mm_sub_epi32(sub, _mm_and_si128(_mm_cmpgt_epi32(habs, zero), _mm_cmplt_epi32(habs, _mm_set1_epi32(0x400))));
+					nan = _mm_sub_epi32(nan, _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7F800000)));
+					__m128 diff = _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_sub_ps(detail::half2float_sse2(hbits), value));
+					error = _mm_max_ps(error, _mm_and_ps(_mm_castsi128_ps(_mm_andnot_si128(_mm_or_si128(inf, null), finite)), 
+						_mm_div_ps(diff, _mm_castsi128_ps(abs))));
+				}
+				int counts[4][4];
+				float errors[4];
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(counts[0]), ovf);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(counts[1]), unf);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(counts[2]), sub);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(counts[3]), nan);
+				_mm_storeu_ps(errors, error);
+				for(unsigned int k=0; k<4; ++k)
+				{
+					stats.overflow += counts[0][k];
+					stats.underflow += counts[1][k];
+					stats.subnormal += counts[2][k];
+					stats.nan += counts[3][k];
+					stats.max_error = std::max(stats.max_error, errors[k]);
+				}
+				return j;
+			}
+		#endif
+
+		#if HALF_ENABLE_F16C_INTRINSICS
+			/// Collect statistics of conversion to half-precision using F16C.
+			/// This classifies the values in the single-precision domain, converting the results back using the hardware 
+			/// conversion and counting in single-precision lanes.
+			/// \param src single-precision source values
+			/// \param dst converted half-precision values
+			/// \param n number of elements
+			/// \param stats statistics to add to
+			/// \return number of elements examined, a multiple of 8
+			static HALF_TARGET("avx,f16c") std::size_t stats_f16c(const float *src, const half *dst, std::size_t n, conversion_stats &stats)
+			{
+				__m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f), inf = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+				__m256 mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF)), ovf = zero, unf = zero, sub = zero, nan = zero, error = zero;
+				std::size_t j = 0;
+				for(; j+8<=n; j+=8)
+				{
+					__m256 value = _mm256_loadu_ps(src+j), abs = _mm256_and_ps(value, mask);
+					__m256 result = _mm256_and_ps(_mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(dst+j))), mask);
+					__m256 finite = _mm256_cmp_ps(abs, inf, _CMP_LT_OQ), nonzero = _mm256_cmp_ps(abs, zero, _CMP_GT_OQ);
+					__m256 overflow = _mm256_cmp_ps(result, inf, _CMP_EQ_OQ);
+					ovf = _mm256_add_ps(ovf, _mm256_and_ps(_mm256_and_ps(finite, overflow), one));
+					unf = _mm256_add_ps(unf, _mm256_and_ps(_mm256_and_ps(nonzero, _mm256_cmp_ps(result, zero, _CMP_EQ_OQ)), one));
+					sub = _mm256_add_ps(sub, _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(result, zero, _CMP_GT_OQ), 
+						_mm256_cmp_ps(result, _mm256_set1_ps(6.103515625e-05f), _CMP_LT_OQ)), one));
+					nan = _mm256_add_ps(nan, _mm256_and_ps(_mm256_cmp_ps(value, value, _CMP_UNORD_Q), one));
+					__m256 diff = _mm256_and_ps(_mm256_sub_ps(result, abs), mask);
+					error = _mm256_max_ps(error, _mm256_and_ps(_mm256_andnot_ps(overflow, _mm256_and_ps(finite, nonzero)), _mm256_div_ps(diff, abs)));
+				}
+				float counts[4][8], errors[8];
+				_mm256_storeu_ps(counts[0], ovf);
+				_mm256_storeu_ps(counts[1], unf);
+				_mm256_storeu_ps(counts[2], sub);
+				_mm256_storeu_ps(counts[3], nan);
+				_mm256_storeu_ps(errors, error);
+				for(unsigned int k=0; k<8; ++k)
+				{
+					stats.overflow += static_cast<std::size_t>(counts[0][k]);
+					stats.underflow += static_cast<std::size_t>(counts[1][k]);
+					stats.subnormal += static_cast<std::size_t>(counts[2][k]);
+					stats.nan += static_cast<std::size_t>(counts[3][k]);
+					stats.max_error = std::max(stats.max_error, errors[k]);
+				}
+				return j;
+			}
+
+			/// Convert 8 single-precision values to half-precision using F16C.
+			/// Lanes the hardware conversion does not handle like the scalar conversion (NaNs, and overflows when truncating) 
+			/// are converted using SSE2 instead.
+			/// Finite overflows are clamped before the hardware conversion when saturating.
+			/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+			/// \tparam E `true` for round to even, `false` for round away from zero
+			/// \tparam S `true` for saturating overflows to the largest finite value, `false` for overflowing to infinity
+			/// \param value single-precision values
+			/// \return binary representations of half-precision values
+			template<std::float_round_style R,bool E,bool S> static HALF_TARGET("avx,f16c") __m128i float2half_f16c(__m256 value)
+			{
+				if(S)
+				{
+					__m256 abs = _mm256_and_ps(value, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF)));
+					__m256 ovf = _mm256_and_ps(_mm256_cmp_ps(abs, _mm256_set1_ps(65504.0f), _CMP_GT_OQ), 
+						_mm256_cmp_ps(abs, _mm256_set1_ps(std::numeric_limits<float>::infinity()), _CMP_LT_OQ));
+					value = _mm256_blendv_ps(value, _mm256_or_ps(_mm256_andnot_ps(abs, value), _mm256_set1_ps(65504.0f)), ovf);
+				}
+				__m256 special = (R==std::round_indeterminate) ? _mm256_cmp_ps(_mm256_and_ps(value, _mm256_castsi256_ps(
+					_mm256_set1_epi32(0x7FFFFFFF))), _mm256_set1_ps(65536.0f), _CMP_NLT_UQ) : _mm256_cmp_ps(value, value, _CMP_UNORD_Q);
+				if(_mm256_movemask_ps(special))
+					return pack_halfs(detail::float2half_sse2<R,E,S>(_mm256_castps256_ps128(value)), 
+						detail::float2half_sse2<R,E,S>(_mm256_extractf128_ps(value, 1)));
+				return _mm256_cvtps_ph(value, (R==std::round_to_nearest) ? 0 : (R==std::round_toward_neg_infinity) ? 1 : 
+					(R==std::round_toward_infinity) ? 2 : 3);
+			}
+
+			/// Convert 8 half-precision values to single-precision using F16C.
+			/// NaNs are converted using SSE2 instead, since the hardware conversion would quiet signaling NaNs.
+			/// \param src binary representations of half-precision values
+			/// \param dst address to store 8 single-precision values at
+			static HALF_TARGET("avx,f16c") void half2float_f16c(__m128i src, float *dst)
+			{
+				if(_mm_movemask_epi8(_mm_cmpgt_epi16(_mm_and_si128(src, _mm_set1_epi16(0x7FFF)), _mm_set1_epi16(0x7C00))))
+					return half2float_sse2(src, dst);
+				_mm256_storeu_ps(dst, _mm256_cvtph_ps(src));
+			}
+
+			/// Convert half-precision array to single-precision using F16C.
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			static HALF_TARGET("avx,f16c") void half2float_f16c(const half *src, float *dst, std::size_t n)
+			{
+				std::size_t i = 0;
+				for(; i+8<=n; i+=8)
+					half2float_f16c(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src+i)), dst+i);
+				if(i < n)
+				{
+					uint16 in[8] = { 0 };
+					float out[8];
+					std::memcpy(in, src+i, (n-i)*sizeof(uint16));
+					half2float_f16c(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)), out);
+					std::memcpy(dst+i, out, (n-i)*sizeof(float));
+				}
+			}
+
+			/// Convert double-precision array to half-precision using F16C.
+			/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+			/// \tparam E `true` for round to even, `false` for round away from zero
+			/// \tparam S `true` for saturating overflows to the largest finite value, `false` for overflowing to infinity
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			template<std::float_round_style R,bool E,bool S> static HALF_TARGET("avx,f16c") void double2half_f16c(const double *src, half *dst, std::size_t n)
+			{
+				std::size_t i = 0;
+				for(; i+8<=n; i+=8)
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), float2half_f16c<R,E,S>(_mm256_insertf128_ps(_mm256_castps128_ps256(
+						double2float_sse2(_mm_loadu_pd(src+i), _mm_loadu_pd(src+i+2))), 
+						double2float_sse2(_mm_loadu_pd(src+i+4), _mm_loadu_pd(src+i+6)), 1)));
+				if(i < n)
+				{
+					double in[8] = { 0.0 };
+					uint16 out[8];
+					std::memcpy(in, src+i, (n-i)*sizeof(double));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out), float2half_f16c<R,E,S>(_mm256_insertf128_ps(_mm256_castps128_ps256(
+						double2float_sse2(_mm_loadu_pd(in), _mm_loadu_pd(in+2))), double2float_sse2(_mm_loadu_pd(in+4), _mm_loadu_pd(in+6)), 1)));
+					std::memcpy(dst+i, out, (n-i)*sizeof(uint16));
+				}
+			}
+
+			/// Convert 8 half-precision values to double-precision using F16C.
+			/// NaNs are converted using SSE2 instead, since the hardware conversion would quiet signaling NaNs.
+			/// \param src binary representations of half-precision values
+			/// \param dst address to store 8 double-precision values at
+			static HALF_TARGET("avx,f16c") void half2double_f16c(__m128i src, double *dst)
+			{
+				if(_mm_movemask_epi8(_mm_cmpgt_epi16(_mm_and_si128(src, _mm_set1_epi16(0x7FFF)), _mm_set1_epi16(0x7C00))))
+					return half2double_sse2(src, dst);
+				__m256 value = _mm256_cvtph_ps(src);
+				_mm256_storeu_pd(dst, _mm256_cvtps_pd(_mm256_castps256_ps128(value)));
+				_mm256_storeu_pd(dst+4, _mm256_cvtps_pd(_mm256_extractf128_ps(value, 1)));
+			}
+
+			/// Convert half-precision array to double-precision using F16C.
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			static HALF_TARGET("avx,f16c") void half2double_f16c(const half *src, double *dst, std::size_t n)
+			{
+				std::size_t i = 0;
+				for(; i+8<=n; i+=8)
+					half2double_f16c(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src+i)), dst+i);
+				if(i < n)
+				{
+					uint16 in[8] = { 0 };
+					double out[8];
+					std::memcpy(in, src+i, (n-i)*sizeof(uint16));
+					half2double_f16c(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)), out);
+					std::memcpy(dst+i, out, (n-i)*sizeof(double));
+				}
+			}
+
+			/// Convert single-precision array to half-precision using F16C.
+			/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+			/// \tparam E `true` for round to even, `false` for round away from zero
+			/// \tparam S `true` for saturating overflows to the largest finite value, `false` for overflowing to infinity
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			template<std::float_round_style R,bool E,bool S> static HALF_TARGET("avx,f16c") void float2half_f16c(const float *src, half *dst, std::size_t n)
+			{
+				std::size_t i = 0;
+				for(; i+8<=n; i+=8)
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), float2half_f16c<R,E,S>(_mm256_loadu_ps(src+i)));
+				if(i < n)
+				{
+					float in[8] = { 0.0f };
+					uint16 out[8];
+					std::memcpy(in, src+i, (n-i)*sizeof(float));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out), float2half_f16c<R,E,S>(_mm256_loadu_ps(in)));
+					std::memcpy(dst+i, out, (n-i)*sizeof(uint16));
+				}
+			}
+
+			/// Convert single-precision array to half-precision using AVX2.
+			/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+			/// \tparam E `true` for round to even, `false` for round away from zero
+			/// \tparam S `true` for saturating overflows to the largest finite value, `false` for overflowing to infinity
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			template<std::float_round_style R,bool E,bool S> static HALF_TARGET("avx2") void float2half_avx2(const float *src, half *dst, std::size_t n)
+			{
+				std::size_t i = 0;
+				for(; i+8<=n; i+=8)
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), detail::float2half_avx2<R,E,S>(_mm256_loadu_ps(src+i)));
+				if(i < n)
+				{
+					float in[8] = { 0.0f };
+					uint16 out[8];
+					std::memcpy(in, src+i, (n-i)*sizeof(float));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out), detail::float2half_avx2<R,E,S>(_mm256_loadu_ps(in)));
+					std::memcpy(dst+i, out, (n-i)*sizeof(uint16));
+				}
+			}
+
+			/// Convert double-precision array to half-precision using AVX2.
+			/// \tparam R rounding mode to use, `std::round_indeterminate` for fastest rounding
+			/// \tparam E `true` for round to even, `false` for round away from zero
+			/// \tparam S `true` for saturating overflows to the largest finite value, `false` for overflowing to infinity
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n number of elements
+			template<std::float_round_style R,bool E,bool S> static HALF_TARGET("avx2") void double2half_avx2(const double *src, half *dst, std::size_t n)
+			{
+				std::size_t i = 0;
+				for(; i+8<=n; i+=8)
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), detail::float2half_avx2<R,E,S>(_mm256_insertf128_ps(_mm256_castps128_ps256(
+						double2float_sse2(_mm_loadu_pd(src+i), _mm_loadu_pd(src+i+2))), 
+						double2float_sse2(_mm_loadu_pd(src+i+4), _mm_loadu_pd(src+i+6)), 1)));
+				if(i < n)
+				{
+					double in[8] = { 0.0 };
+					uint16 out[8];
+					std::memcpy(in, src+i, (n-i)*sizeof(double));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out), detail::float2half_avx2<R,E,S>(_mm256_insertf128_ps(_mm256_castps128_ps256(
+						double2float_sse2(_mm_loadu_pd(in), _mm_loadu_pd(in+2))), double2float_sse2(_mm_loadu_pd(in+4), _mm_loadu_pd(in+6)), 1)));
+					std::memcpy(dst+i, out, (n-i)*sizeof(uint16));
+				}
+			}
+
+			/// Load 8 half-precision values as single-precision using F16C.
+			/// \param src address of half-precision values
+			/// \return single-precision values
+			static HALF_TARGET("avx,f16c") __m256 load_f16c(const half *src) { return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))); }
+
+			/// Load up to 8 half-precision values as single-precision using F16C.
+			/// \param src address of half-precision values
+			/// \param n number of values to load, remaining lanes are zero
+			/// \return single-precision values
+			static HALF_TARGET("avx,f16c") __m256 load_f16c(const half *src, std::size_t n)
+			{
+				uint16 in[8] = { 0 };
+				std::memcpy(in, src, n*sizeof(uint16));
+				return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+			}
+
+			/// Load 8 single-precision values.
+			/// \param src address of single-precision values
+			/// \return single-precision values
+			static HALF_TARGET("avx,f16c") __m256 load_f16c(const float *src) { return _mm256_loadu_ps(src); }
+
+			/// Load up to 8 single-precision values.
+			/// \param src address of single-precision values
+			/// \param n number of values to load, remaining lanes are zero
+			/// \return single-precision values
+			static HALF_TARGET("avx,f16c") __m256 load_f16c(const float *src, std::size_t n)
+			{
+				float in[8] = { 0.0f };
+				std::memcpy(in, src, n*sizeof(float));
+				return _mm256_loadu_ps(in);
+			}
+
+			/// Dot product of half-precision arrays in single-precision using F16C.
+			/// \tparam U type of second array, `half` or `float`
+			/// \param x first array
+			/// \param y second array
+			/// \param n number of elements
+			/// \return sum of products
+			template<typename U> static HALF_TARGET("avx,f16c") float dot_f16c(const half *x, const U *y, std::size_t n, float)
+			{
+				__m256 sum[4] = { _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps() };
+				std::size_t i = 0;
+				for(; i+32<=n; i+=32)
+					for(int k=0; k<4; ++k)
+						sum[k] = _mm256_add_ps(sum[k], _mm256_mul_ps(load_f16c(x+i+8*k), load_f16c(y+i+8*k)));
+				for(; i+8<=n; i+=8)
+					sum[0] = _mm256_add_ps(sum[0], _mm256_mul_ps(load_f16c(x+i), load_f16c(y+i)));
+				if(i < n)
+					sum[1] = _mm256_add_ps(sum[1], _mm256_mul_ps(load_f16c(x+i, n-i), load_f16c(y+i, n-i)));
+				__m256 total = _mm256_add_ps(_mm256_add_ps(sum[0], sum[1]), _mm256_add_ps(sum[2], sum[3]));
+				__m128 low = _mm_add_ps(_mm256_castps256_ps128(total), _mm256_extractf128_ps(total, 1));
+				low = _mm_add_ps(low, _mm_movehl_ps(low, low));
+				return _mm_cvtss_f32(_mm_add_ss(low, _mm_shuffle_ps(low, low, 1)));
+			}
+
+			/// Dot product of half-precision arrays in double-precision using F16C.
+			/// \tparam U type of second array, `half` or `float`
+			/// \param x first array
+			/// \param y second array
+			/// \param n number of elements
+			/// \return sum of products
+			template<typename U> static HALF_TARGET("avx,f16c") double dot_f16c(const half *x, const U *y, std::size_t n, double)
+			{
+				__m256d sum[4] = { _mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd() };
+				std::size_t i = 0;
+				for(; i+16<=n; i+=16)
+					for(int k=0; k<2; ++k)
+					{
+						__m256 p = _mm256_mul_ps(load_f16c(x+i+8*k), load_f16c(y+i+8*k));
+						sum[2*k] = _mm256_add_pd(sum[2*k], _mm256_cvtps_pd(_mm256_castps256_ps128(p)));
+						sum[2*k+1] = _mm256_add_pd(sum[2*k+1], _mm256_cvtps_pd(_mm256_extractf128_ps(p, 1)));
+					}
+				for(; i<n; i+=8)
+				{
+					__m256 p = (i+8<=n) ? _mm256_mul_ps(load_f16c(x+i), load_f16c(y+i)) : _mm256_mul_ps(load_f16c(x+i, n-i), load_f16c(y+i, n-i));
+					sum[0] = _mm256_add_pd(sum[0], _mm256_cvtps_pd(_mm256_castps256_ps128(p)));
+					sum[1] = _mm256_add_pd(sum[1], _mm256_cvtps_pd(_mm256_extractf128_ps(p, 1)));
+				}
+				__m256d total = _mm256_add_pd(_mm256_add_pd(sum[0], sum[1]), _mm256_add_pd(sum[2], sum[3]));
+				__m128d low = _mm_add_pd(_mm256_castpd256_pd128(total), _mm256_extractf128_pd(total, 1));
+				return _mm_cvtsd_f64(_mm_add_sd(low, _mm_unpackhi_pd(low, low)));
+			}
+
+			/// Apply bitwise operation to half-precision arrays using AVX2.
+			/// \tparam F bitwise operation
+			/// \param x first operand array
+			/// \param y second operand array
+			/// \param dst destination array
+			/// \param n number of elements
+			/// \param f operation to apply
+			/// \return number of elements processed, a multiple of 16
+			template<typename F> static HALF_TARGET("avx2") std::size_t bitwise_avx2(const half *x, const half *y, half *dst, std::size_t n, F f)
+			{
+				std::size_t i = 0;
+				for(; i+32<=n; i+=32)
+				{
+					__m256i a = f(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(x+i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y+i)));
+					__m256i b = f(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(x+i+16)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y+i+16)));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst+i), a);
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst+i+16), b);
+				}
+				if(i+16 <= n)
+				{
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst+i), f(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(x+i)), 
+						_mm256_loadu_si256(reinterpret_cast<const __m256i*>(y+i))));
+					i += 16;
+				}
+				return i;
+			}
+		#endif
+		};
+
+	#if HALF_ENABLE_CPP11_THREAD
+		/// Pool of worker threads for parallel bulk operations.
+		/// The thread calling run() always takes part in the work itself, so a pool of size 1 doesn't start any threads.
+		class thread_pool
+		{
+		public:
+			/// Start worker threads.
+			/// \param threads total number of threads including the calling thread
+			explicit thread_pool(unsigned int threads) : task_(), owner_(), generation_(0), pending_(0), stop_(false)
+			{
+				for(unsigned int i=1; i<threads; ++i)
+					workers_.push_back(std::thread(&thread_pool::work, this, i));
+			}
+
+			/// Stop and join worker threads.
+			~thread_pool()
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					stop_ = true;
+				}
+				start_.notify_all();
+				for(std::size_t i=0; i<workers_.size(); ++i)
+					workers_[i].join();
+			}
+
+			/// Number of threads.
+			/// \return total number of threads including the calling thread
+			unsigned int size() const { return static_cast<unsigned int>(workers_.size()) + 1; }
+
+			/// Run task on all threads and wait for its completion.
+			/// Concurrent calls from different threads are serialized. Calls from inside a task of this pool, i.e. nested 
+			/// parallel operations, can't wait for the pool and instead call the task for all indices on the calling thread.
+			/// \param task function to call with the index of each thread
+			void run(const std::function<void(unsigned int)> &task)
+			{
+				if(nested())
+				{
+					for(unsigned int i=0; i<size(); ++i)
+						task(i);
+					return;
+				}
+				std::lock_guard<std::mutex> serial(run_mutex_);
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					task_ = &task;
+					pending_ = workers_.size();
+					owner_ = std::this_thread::get_id();
+					++generation_;
+				}
+				start_.notify_all();
+				task(0);
+				std::unique_lock<std::mutex> lock(mutex_);
+				while(pending_)
+					done_.wait(lock);
+				owner_ = std::thread::id();
+			}
+
+		private:
+			thread_pool(const thread_pool&);
+			thread_pool& operator=(const thread_pool&);
+
+			/// Check if called from inside a task of this pool.
+			/// \retval true if calling thread is a worker or currently runs a task as caller of run()
+			/// \retval false else
+			bool nested()
+			{
+				std::thread::id id = std::this_thread::get_id();
+				for(std::size_t i=0; i<workers_.size(); ++i)
+					if(workers_[i].get_id() == id)
+						return true;
+				std::lock_guard<std::mutex> lock(mutex_);
+				return owner_ == id;
+			}
+
+			/// Worker thread loop.
+			/// \param index index of worker thread
+			void work(unsigned int index)
+			{
+				unsigned long generation = 0;
+				std::unique_lock<std::mutex> lock(mutex_);
+				for(;;)
+				{
+					while(!stop_ && generation_ == generation)
+						start_.wait(lock);
+					if(stop_)
+						return;
+					generation = generation_;
+					const std::function<void(unsigned int)> *task = task_;
+					lock.unlock();
+					(*task)(index);
+					lock.lock();
+					if(!--pending_)
+						done_.notify_one();
+				}
+			}
+
+			std::vector<std::thread> workers_;
+			std::mutex mutex_;
+			std::mutex run_mutex_;
+			std::condition_variable start_;
+			std::condition_variable done_;
+			const std::function<void(unsigned int)> *task_;
+			std::thread::id owner_;
+			unsigned long generation_;
+			std::size_t pending_;
+			bool stop_;
+		};
+
+		/// Access pool used for parallel bulk operations.
+		/// The pool is created on first use with as many threads as the hardware supports. It is shared with every caller, so 
+		/// when it is recreated with a different size, operations still running on the old pool keep it alive until they 
+		/// are finished.
+		/// \param threads number of threads to recreate the pool with, 0 for keeping the current pool
+		/// \return thread pool
+		inline std::shared_ptr<thread_pool> parallel_pool(unsigned int threads = 0)
+		{
+			static std::mutex mutex;
+			static std::shared_ptr<thread_pool> pool;
+			std::lock_guard<std::mutex> lock(mutex);
+			if(!pool || (threads && threads != pool->size()))
+			{
+				pool.reset();
+				pool = std::make_shared<thread_pool>(threads ? threads : std::max(std::thread::hardware_concurrency(), 1u));
+			}
+			return pool;
+		}
+	#endif
+
+		/// Chunk size for parallel bulk operations.
+		/// This many elements of source and destination together fit into the L2 cache of common processors.
+		HALF_CONSTEXPR_CONST std::size_t parallel_chunk = 1 << 14;
+
+		/// Number of threads for parallel bulk operations.
+		/// \return number of threads in the pool including the calling thread, 1 without thread support
+		inline unsigned int parallel_threads()
+		{
+		#if HALF_ENABLE_CPP11_THREAD
+			return parallel_pool()->size();
+		#else
+			return 1;
+		#endif
+		}
+
+		/// Call function on chunks of a range in parallel.
+		/// The chunks are handed out dynamically to balance the load between threads, unless \a first_touch is set, in which 
+		/// case each thread processes one contiguous part of the range. The latter makes each thread the first to write to 
+		/// its part of a freshly allocated destination, so that its memory pages are placed on that thread's NUMA node.
+		/// \tparam F function type
+		/// \param n number of elements
+		/// \param first_touch `true` for static contiguous partitioning, `false` for dynamic chunk scheduling
+		/// \param f function to call with the beginning and end of each chunk
+		/// \param chunk number of elements per chunk
+		template<typename F> void parallel_for(std::size_t n, bool first_touch, F f, std::size_t chunk = parallel_chunk)
+		{
+			std::size_t chunks = (n+chunk-1) / chunk;
+		#if HALF_ENABLE_CPP11_THREAD
+			if(chunks > 1)
+			{
+				std::shared_ptr<thread_pool> pool = parallel_pool();
+				unsigned int threads = pool->size();
+				if(threads > 1)
+				{
+					std::atomic<std::size_t> next(0);
+					pool->run([&](unsigned int index) {
+						if(first_touch)
+						{
+							for(std::size_t c=chunks*index/threads, end=chunks*(index+1)/threads; c<end; ++c)
+								f(c*chunk, std::min((c+1)*chunk, n));
+						}
+						else
+							for(std::size_t c; (c=next++)<chunks; )
+								f(c*chunk, std::min((c+1)*chunk, n));
+					});
+					return;
+				}
+			}
+		#else
+			static_cast<void>(first_touch);
+		#endif
+			for(std::size_t c=0; c<chunks; ++c)
+				f(c*chunk, std::min((c+1)*chunk, n));
+		}
+
+		/// Bulk conversion of one chunk.
+		/// \tparam T source type
+		/// \tparam U destination type
+		template<typename T,typename U> struct convert_chunk
+		{
+			/// Initialize.
+			/// \param src source array
+			/// \param dst destination array
+			/// \param n total number of elements, determining if to use non-temporal stores
+			/// \param kernel bulk conversion to use
+			convert_chunk(const T *src, U *dst, std::size_t n, void (*kernel)(const T*,U*,std::size_t))
+				: src_(src), dst_(dst), kernel_(kernel), stream_(bulk::streaming(n*sizeof(U))) {}
+
+			/// Convert chunk.
+			/// \param begin index of first element
+			/// \param end index after last element
+			void operator()(std::size_t begin, std::size_t end) const
+			{
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				if(stream_)
+					return bulk::stream(src_+begin, dst_+begin, end-begin, kernel_);
+			#endif
+				kernel_(src_+begin, dst_+begin, end-begin);
+			}
+
+		private:
+			const T *src_;
+			U *dst_;
+			void (*kernel_)(const T*,U*,std::size_t);
+			bool stream_;
+		};
+
+		/// Bulk conversion of one chunk with stochastic rounding.
+		struct stochastic_chunk
+		{
+			/// Initialize.
+			/// \param src source array
+			/// \param dst destination array
+			/// \param seed seed of random number generator
+			/// \param counter counter of random number to use for first element
+			stochastic_chunk(const float *src, half *dst, unsigned long seed, std::size_t counter)
+				: src_(src), dst_(dst), seed_(seed), counter_(counter) {}
+
+			/// Convert chunk.
+			/// \param begin index of first element
+			/// \param end index after last element
+			void operator()(std::size_t begin, std::size_t end) const
+			{
+				bulk::float2half_stochastic(src_+begin, dst_+begin, end-begin, seed_, counter_+begin);
+			}
+
+		private:
+			const float *src_;
+			half *dst_;
+			unsigned long seed_;
+			std::size_t counter_;
+		};
+
+		/// Array accessed with a constant stride.
+		/// \tparam T element type
+		template<typename T> struct strided_array
+		{
+			/// Initialize.
+			/// \param data pointer to first element
+			/// \param stride distance between consecutive elements in elements
+			strided_array(T *data, std::ptrdiff_t stride) : data_(data), stride_(stride) {}
+
+			/// Access element.
+			/// \param i index of element
+			/// \return reference to element
+			T& operator[](std::size_t i) const { return data_[static_cast<std::ptrdiff_t>(i)*stride_]; }
+
+			/// Access contiguous elements.
+			/// \param i index of first element
+			/// \return pointer to element if the array is contiguous, `NULL` else
+			T* contiguous(std::size_t i) const { return (stride_==1) ? (data_+i) : NULL; }
+
+		private:
+			T *data_;
+			std::ptrdiff_t stride_;
+		};
+
+		/// Array accessed through a list of indices.
+		/// \tparam T element type
+		template<typename T> struct indexed_array
+		{
+			/// Initialize.
+			/// \param data pointer to array
+			/// \param index indices of elements to access
+			indexed_array(T *data, const std::size_t *index) : data_(data), index_(index) {}
+
+			/// Access element.
+			/// \param i position in index list
+			/// \return reference to element
+			T& operator[](std::size_t i) const { return data_[index_[i]]; }
+
+			/// Access contiguous elements.
+			/// \return `NULL`
+			T* contiguous(std::size_t) const { return NULL; }
+
+		private:
+			T *data_;
+			const std::size_t *index_;
+		};
+
+		/// Bulk conversion of non-contiguous arrays.
+		/// This gathers blocks of source elements into a buffer, converts them at once and scatters the results into the 
+		/// destination. Contiguous sides are accessed directly without staging.
+		/// \tparam T source element type
+		/// \tparam U destination element type
+		/// \tparam S source array type
+		/// \tparam D destination array type
+		/// \param src source array
+		/// \param dst destination array
+		/// \param n number of elements
+		/// \param kernel bulk conversion to use
+		template<typename T,typename U,typename S,typename D> void convert_staged(S src, D dst, std::size_t n, void (*kernel)(const T*,U*,std::size_t))
+		{
+			static const std::size_t block = 256;
+			T in[block];
+			U out[block];
+			for(std::size_t i=0; i<n; i+=block)
+			{
+				std::size_t m = std::min(n-i, block);
+				const T *pin = src.contiguous(i);
+				if(!pin)
+				{
+					for(std::size_t j=0; j<m; ++j)
+						in[j] = src[i+j];
+					pin = in;
+				}
+				if(U *pout = dst.contiguous(i))
+					kernel(pin, pout, m);
+				else
+				{
+					kernel(pin, out, m);
+					for(std::size_t j=0; j<m; ++j)
+						dst[i+j] = out[j];
+				}
+			}
+		}
+
+		/// Bulk conversion to a narrower type within the same array.
+		/// This converts blocks of the array front to back into a buffer and copies the results to the front of the 
+		/// array. Each block of results ends before the source block it was converted from, so it only ever overwrites 
+		/// source elements that were already converted.
+		/// \tparam T source type
+		/// \tparam U destination type, not larger than \a T
+		/// \param data array to convert
+		/// \param n number of elements
+		/// \param kernel bulk conversion to use
+		/// \return pointer to first converted element at the beginning of \a data
+		template<typename T,typename U> U* convert_narrowing(T *data, std::size_t n, void (*kernel)(const T*,U*,std::size_t))
+		{
+			static const std::size_t block = 1024;
+			U buffer[block];
+			char *bytes = reinterpret_cast<char*>(data);
+			for(std::size_t i=0; i<n; i+=block)
+			{
+				std::size_t m = std::min(n-i, block);
+				kernel(data+i, buffer, m);
+				std::memcpy(bytes+i*sizeof(U), buffer, m*sizeof(U));
+			}
+			return reinterpret_cast<U*>(data);
+		}
+
+		/// Bulk conversion to a wider type within the same array.
+		/// This converts blocks of the array back to front into a buffer and copies the results to their final 
+		/// position. Each block of results starts behind the source block it was converted from, so it only ever 
+		/// overwrites source elements that were already converted.
+		/// \tparam T source type
+		/// \tparam U destination type, not smaller than \a T
+		/// \param data array to convert, must have room for \a n elements of type \a U and be suitably aligned for them
+		/// \param n number of elements
+		/// \param kernel bulk conversion to use
+		/// \return pointer to first converted element at the beginning of \a data
+		template<typename T,typename U> U* convert_widening(T *data, std::size_t n, void (*kernel)(const T*,U*,std::size_t))
+		{
+			static const std::size_t block = 1024;
+			U buffer[block];
+			char *bytes = reinterpret_cast<char*>(data);
+			for(std::size_t i=n; i>0; )
+			{
+				std::size_t m = std::min(i, block);
+				i -= m;
+				kernel(data+i, buffer, m);
+				std::memcpy(bytes+i*sizeof(U), buffer, m*sizeof(U));
+			}
+			return reinterpret_cast<U*>(data);
+		}
+
+		/// Deinterleave half-precision values.
+		/// \param src interleaved values
+		/// \param dst planar arrays for each channel
+		/// \param channels number of channels
+		/// \param offset index of first element to store in planar arrays
+		/// \param n number of elements per channel
+		inline void deinterleave(const half *src, half *const *dst, std::size_t channels, std::size_t offset, std::size_t n)
+		{
+			std::size_t i = 0;
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			if(channels == 4 && bulk::simd_layout())
+			{
+				for(; i+8<=n; i+=8)
+				{
+					const __m128i *in = reinterpret_cast<const __m128i*>(src+4*i);
+					__m128i x0 = _mm_loadu_si128(in), x1 = _mm_loadu_si128(in+1), x2 = _mm_loadu_si128(in+2), x3 = _mm_loadu_si128(in+3);
+					__m128i t0 = _mm_unpacklo_epi16(x0, x1), t1 = _mm_unpackhi_epi16(x0, x1);
+					__m128i t2 = _mm_unpacklo_epi16(x2, x3), t3 = _mm_unpackhi_epi16(x2, x3);
+					__m128i u0 = _mm_unpacklo_epi16(t0, t1), u1 = _mm_unpackhi_epi16(t0, t1);
+					__m128i u2 = _mm_unpacklo_epi16(t2, t3), u3 = _mm_unpackhi_epi16(t2, t3);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst[0]+offset+i), _mm_unpacklo_epi64(u0, u2));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst[1]+offset+i), _mm_unpackhi_epi64(u0, u2));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst[2]+offset+i), _mm_unpacklo_epi64(u1, u3));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst[3]+offset+i), _mm_unpackhi_epi64(u1, u3));
+				}
+			}
+		#endif
+			for(; i<n; ++i)
+				for(std::size_t c=0; c<channels; ++c)
+					dst[c][offset+i] = src[i*channels+c];
+		}
+
+		/// Interleave half-precision values.
+		/// \param src planar arrays for each channel
+		/// \param channels number of channels
+		/// \param offset index of first element to load from planar arrays
+		/// \param n number of elements per channel
+		/// \param dst array to store interleaved values into
+		inline void interleave(const half *const *src, std::size_t channels, std::size_t offset, std::size_t n, half *dst)
+		{
+			std::size_t i = 0;
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			if(channels == 4 && bulk::simd_layout())
+			{
+				for(; i+8<=n; i+=8)
+				{
+					__m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src[0]+offset+i));
+					__m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src[1]+offset+i));
+					__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src[2]+offset+i));
+					__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src[3]+offset+i));
+					__m128i rg0 = _mm_unpacklo_epi16(r, g), rg1 = _mm_unpackhi_epi16(r, g);
+					__m128i ba0 = _mm_unpacklo_epi16(b, a), ba1 = _mm_unpackhi_epi16(b, a);
+					__m128i *out = reinterpret_cast<__m128i*>(dst+4*i);
+					_mm_storeu_si128(out, _mm_unpacklo_epi32(rg0, ba0));
+					_mm_storeu_si128(out+1, _mm_unpackhi_epi32(rg0, ba0));
+					_mm_storeu_si128(out+2, _mm_unpacklo_epi32(rg1, ba1));
+					_mm_storeu_si128(out+3, _mm_unpackhi_epi32(rg1, ba1));
+				}
+			}
+		#endif
+			for(; i<n; ++i)
+				for(std::size_t c=0; c<channels; ++c)
+					dst[i*channels+c] = src[c][offset+i];
+		}
+
+		/// Bulk conversion of interleaved channels to planar half-precision arrays.
+		/// This converts blocks of the source array into a buffer and deinterleaves the results from there.
+		/// \tparam T source type
+		/// \param src interleaved source array
+		/// \param dst planar destination arrays for each channel
+		/// \param channels number of channels
+		/// \param n number of elements per channel
+		/// \param kernel bulk conversion to use
+		template<typename T> void convert_deinterleaved(const T *src, half *const *dst, std::size_t channels, std::size_t n, void (*kernel)(const T*,half*,std::size_t))
+		{
+			static const std::size_t size = 1024;
+			if(channels > size)
+			{
+				for(std::size_t c=0; c<channels; ++c)
+					convert_staged(strided_array<const T>(src+c, static_cast<std::ptrdiff_t>(channels)), strided_array<half>(dst[c], 1), n, kernel);
+				return;
+			}
+			half buffer[size];
+			for(std::size_t i=0, block=channels ? (size/channels) : n; i<n; i+=block)
+			{
+				std::size_t m = std::min(n-i, block);
+				kernel(src+i*channels, buffer, m*channels);
+				deinterleave(buffer, dst, channels, i, m);
+			}
+		}
+
+		/// Bulk conversion of planar half-precision arrays to interleaved channels.
+		/// This interleaves blocks of the source arrays into a buffer and converts them from there into the destination.
+		/// \tparam U destination type
+		/// \param src planar source arrays for each channel
+		/// \param dst interleaved destination array
+		/// \param channels number of channels
+		/// \param n number of elements per channel
+		/// \param kernel bulk conversion to use
+		template<typename U> void convert_interleaved(const half *const *src, U *dst, std::size_t channels, std::size_t n, void (*kernel)(const half*,U*,std::size_t))
+		{
+			static const std::size_t size = 1024;
+			if(channels > size)
+			{
+				for(std::size_t c=0; c<channels; ++c)
+					convert_staged(strided_array<const half>(src[c], 1), strided_array<U>(dst+c, static_cast<std::ptrdiff_t>(channels)), n, kernel);
+				return;
+			}
+			half buffer[size];
+			for(std::size_t i=0, block=channels ? (size/channels) : n; i<n; i+=block)
+			{
+				std::size_t m = std::min(n-i, block);
+				interleave(src, channels, i, m, buffer);
+				kernel(buffer, dst+i*channels, m*channels);
+			}
+		}
+
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		/// \name SIMD mathematical functions
+		/// \{
+
+		/// Evaluate polynomial using SSE2.
+		/// \param x arguments
+		/// \param c coefficients from highest to lowest degree
+		/// \param n number of coefficients
+		/// \return polynomial values
+		inline __m128 poly_sse2(__m128 x, const float *c, std::size_t n)
+		{
+			__m128 y = _mm_set1_ps(c[0]);
+			for(std::size_t i=1; i<n; ++i)
+				y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(c[i]));
+			return y;
+		}
+
+		/// Single-precision exponential using SSE2.
+		/// This reduces the argument to [-ln(2)/2,ln(2)/2] and approximates the exponential there with a minimax polynomial 
+		/// of degree 4, giving a relative error of about 2^-18, which leaves a few guard bits beyond the 11 bits of 
+		/// half-precision.
+		/// \param x arguments in [-87,88]
+		/// \return function values
+		inline __m128 exp_sse2(__m128 x)
+		{
+			static const float c[] = { 4.242561637e-02f, 1.681754428e-01f, 4.999543962e-01f, 9.999452810e-01f, 1.0f };
+			__m128i n = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.44269504089f)));
+			__m128 k = _mm_cvtepi32_ps(n);
+			__m128 r = _mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(k, _mm_set1_ps(0.693359375f))), _mm_mul_ps(k, _mm_set1_ps(-2.12194440e-4f)));
+			return _mm_mul_ps(poly_sse2(r, c, 5), _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23)));
+		}
+
+		/// Replace values by infinity using SSE2.
+		/// \param mask mask of values to replace
+		/// \param y values
+		/// \return values with infinity where \a mask is set
+		inline __m128 overflow_sse2(__m128 mask, __m128 y)
+		{
+			return _mm_castsi128_ps(select(_mm_castps_si128(mask), _mm_set1_epi32(0x7F800000), _mm_castps_si128(y)));
+		}
+
+		/// Single-precision natural logarithm of mantissa using SSE2.
+		/// This splits the argument into an exponent and a mantissa in [sqrt(0.5),sqrt(2)) and approximates the logarithm of 
+		/// the latter by a minimax polynomial in `s=(m-1)/(m+1)` with a relative error of about 2^-22. This is the lowest 
+		/// degree that still leaves guard bits for half-precision, the next lower one only reaches 2^-15.
+		/// \param x positive normalized arguments
+		/// \param e variable to store exponents in
+		/// \return logarithms of mantissas
+		inline __m128 log_mantissa_sse2(__m128 x, __m128 &e)
+		{
+			static const float c[] = { 2.060099691e-01f, 3.332781196e-01f };
+			__m128i bits = _mm_sub_epi32(_mm_castps_si128(x), _mm_set1_epi32(0x3F3504F3));
+			e = _mm_cvtepi32_ps(_mm_srai_epi32(bits, 23));
+			__m128 m = _mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7FFFFF)), _mm_set1_epi32(0x3F3504F3)));
+			__m128 s = _mm_div_ps(_mm_sub_ps(m, _mm_set1_ps(1.0f)), _mm_add_ps(m, _mm_set1_ps(1.0f)));
+			__m128 t = _mm_mul_ps(s, s), s2 = _mm_add_ps(s, s);
+			return _mm_add_ps(s2, _mm_mul_ps(_mm_mul_ps(s2, t), poly_sse2(t, c, 2)));
+		}
+
+		/// Single-precision sine or cosine of half-precision arguments using SSE2.
+		/// The arguments are reduced to [-pi/4,pi/4] in double-precision, which is exact enough for any half-precision 
+		/// argument, and the reduced sine and cosine approximated by minimax polynomials of degree 5 and 6 with relative 
+		/// errors of about 2^-19 and 2^-23, as degree 4 would only give 2^-15 for the cosine. 
+		/// The reduced sine always gets the sign of the reduced argument, so the sine of negative zero is negative zero.
+		/// \param x finite arguments representable in half-precision
+		/// \param quadrant 0 for sine, 1 for cosine
+		/// \return function values
+		inline __m128 sincos_sse2(__m128 x, int quadrant)
+		{
+			static const float s[] = { 8.162849479e-03f, -1.666337360e-01f }, c[] = { -1.364871394e-03f, 4.166107252e-02f };
+			__m128d xlo = _mm_cvtps_pd(x), xhi = _mm_cvtps_pd(_mm_movehl_ps(x, x)), factor = _mm_set1_pd(0.63661977236758134308);
+			__m128d pi1 = _mm_set1_pd(1.5707963267923333), pi2 = _mm_set1_pd(2.5633441515945189e-12);
+			__m128i klo = _mm_cvtpd_epi32(_mm_mul_pd(xlo, factor)), khi = _mm_cvtpd_epi32(_mm_mul_pd(xhi, factor));
+			__m128d kdlo = _mm_cvtepi32_pd(klo), kdhi = _mm_cvtepi32_pd(khi);
+			__m128 r = _mm_movelh_ps(_mm_cvtpd_ps(_mm_sub_pd(_mm_sub_pd(xlo, _mm_mul_pd(kdlo, pi1)), _mm_mul_pd(kdlo, pi2))), 
+				_mm_cvtpd_ps(_mm_sub_pd(_mm_sub_pd(xhi, _mm_mul_pd(kdhi, pi1)), _mm_mul_pd(kdhi, pi2))));
+			__m128i q = _mm_add_epi32(_mm_unpacklo_epi64(klo, khi), _mm_set1_epi32(quadrant));
+			__m128 t = _mm_mul_ps(r, r);
+			__m128 ys = _mm_or_ps(_mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, t), poly_sse2(t, s, 2))), _mm_and_ps(r, _mm_set1_ps(-0.0f)));
+			__m128 yc = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(t, _mm_set1_ps(0.5f))), _mm_mul_ps(_mm_mul_ps(t, t), poly_sse2(t, c, 2)));
+			__m128i odd = _mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1));
+			__m128i y = select(odd, _mm_castps_si128(yc), _mm_castps_si128(ys));
+			return _mm_castsi128_ps(_mm_xor_si128(y, _mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30)));
+		}
+		/// \}
+	#endif
+
+		/// Exponential for bulk evaluation.
+		/// The SIMD kernel of each function is accompanied by a bound for its relative error in the half-precision range as 
+		/// well as a double-precision reference implementation used for arguments the kernel doesn't handle and results too 
+		/// close to a rounding boundary. The error bounds are twice the largest errors measured over all half-precision 
+		/// arguments.
+		struct math_exp
+		{
+			/// Double-precision reference.
+			/// \param arg function argument
+			/// \return function value
+			static double reference(double arg) { return std::exp(arg); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Relative error bound of SIMD kernel.
+			/// \return error bound
+			static float error() { return 1.52587891e-5f; }
+
+			/// Arguments to use the reference for.
+			/// \param x function arguments
+			/// \return mask of arguments not handled by SIMD kernel
+			static __m128 special(__m128 x) { return _mm_cmpunord_ps(x, x); }
+
+			/// SIMD kernel.
+			/// Arguments are clamped to where the result is too small or too large for half-precision in any rounding mode. 
+			/// Like the reference it underflows to 0 below -745.13 and overflows to infinity above 709.78.
+			/// \param x function arguments
+			/// \return function values
+			static __m128 eval(__m128 x)
+			{
+				__m128 y = exp_sse2(_mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-18.0f)), _mm_set1_ps(12.0f)));
+				return overflow_sse2(_mm_cmpgt_ps(x, _mm_set1_ps(709.75f)), _mm_andnot_ps(_mm_cmplt_ps(x, _mm_set1_ps(-745.25f)), y));
+			}
+		#endif
+		};
+
+		/// Binary exponential for bulk evaluation.
+		struct math_exp2
+		{
+			/// Double-precision reference.
+			/// \param arg function argument
+			/// \return function value
+			static double reference(double arg)
+			{
+			#if HALF_ENABLE_CPP11_CMATH
+				return std::exp2(arg);
+			#else
+				return std::pow(2.0, arg);
+			#endif
+			}
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Relative error bound of SIMD kernel.
+			/// \return error bound
+			static float error() { return 1.52587891e-5f; }
+
+			/// Arguments to use the reference for.
+			/// \param x function arguments
+			/// \return mask of arguments not handled by SIMD kernel
+			static __m128 special(__m128 x) { return _mm_cmpunord_ps(x, x); }
+
+			/// SIMD kernel.
+			/// This splits off the integer part exactly, so integral arguments give exact powers of 2. Like the reference it 
+			/// underflows to 0 from -1075 on and overflows to infinity from 1024 on.
+			/// \param x function arguments
+			/// \return function values
+			static __m128 eval(__m128 x)
+			{
+				__m128 c = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-26.0f)), _mm_set1_ps(17.0f));
+				__m128i n = _mm_cvtps_epi32(c);
+				__m128 r = _mm_mul_ps(_mm_sub_ps(c, _mm_cvtepi32_ps(n)), _mm_set1_ps(0.69314718056f));
+				__m128 y = _mm_castsi128_ps(_mm_add_epi32(_mm_castps_si128(exp_sse2(r)), _mm_slli_epi32(n, 23)));
+				return overflow_sse2(_mm_cmpgt_ps(x, _mm_set1_ps(1023.75f)), _mm_andnot_ps(_mm_cmplt_ps(x, _mm_set1_ps(-1074.5f)), y));
+			}
+		#endif
+		};
+
+		/// Natural logarithm for bulk evaluation.
+		struct math_log
+		{
+			/// Double-precision reference.
+			/// \param arg function argument
+			/// \return function value
+			static double reference(double arg) { return std::log(arg); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Relative error bound of SIMD kernel.
+			/// \return error bound
+			static float error() { return 4.76837158e-7f; }
+
+			/// Arguments to use the reference for.
+			/// \param x function arguments
+			/// \return mask of arguments not handled by SIMD kernel
+			static __m128 special(__m128 x) { return _mm_or_ps(_mm_cmpngt_ps(x, _mm_setzero_ps()), _mm_cmpeq_ps(x, _mm_set1_ps(std::numeric_limits<float>::infinity()))); }
+
+			/// SIMD kernel.
+			/// \param x function arguments
+			/// \return function values
+			static __m128 eval(__m128 x)
+			{
+				__m128 e, m = log_mantissa_sse2(x, e);
+				return _mm_add_ps(_mm_mul_ps(e, _mm_set1_ps(0.693359375f)), _mm_add_ps(m, _mm_mul_ps(e, _mm_set1_ps(-2.12194440e-4f))));
+			}
+		#endif
+		};
+
+		/// Binary logarithm for bulk evaluation.
+		struct math_log2
+		{
+			/// Double-precision reference.
+			/// \param arg function argument
+			/// \return function value
+			static double reference(double arg)
+			{
+			#if HALF_ENABLE_CPP11_CMATH
+				return std::log2(arg);
+			#else
+				return std::log(arg) * 1.4426950408889634073599246810019;
+			#endif
+			}
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Relative error bound of SIMD kernel.
+			/// \return error bound
+			static float error() { return 4.76837158e-7f; }
+
+			/// Arguments to use the reference for.
+			/// \param x function arguments
+			/// \return mask of arguments not handled by SIMD kernel
+			static __m128 special(__m128 x) { return math_log::special(x); }
+
+			/// SIMD kernel.
+			/// This keeps the exponent exact, so powers of 2 give exact integers.
+			/// \param x function arguments
+			/// \return function values
+			static __m128 eval(__m128 x)
+			{
+				__m128 e, m = log_mantissa_sse2(x, e);
+				return _mm_add_ps(e, _mm_mul_ps(m, _mm_set1_ps(1.44269504089f)));
+			}
+		#endif
+		};
+
+		/// Square root for bulk evaluation.
+		struct math_sqrt
+		{
+			/// Double-precision reference.
+			/// \param arg function argument
+			/// \return function value
+			static double reference(double arg) { return std::sqrt(arg); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Relative error bound of SIMD kernel.
+			/// \return error bound
+			static float error() { return 1.19209290e-7f; }
+
+			/// Arguments to use the reference for.
+			/// \param x function arguments
+			/// \return mask of arguments not handled by SIMD kernel
+			static __m128 special(__m128 x) { return _mm_cmpnge_ps(x, _mm_setzero_ps()); }
+
+			/// SIMD kernel.
+			/// \param x function arguments
+			/// \return function values
+			static __m128 eval(__m128 x) { return _mm_sqrt_ps(x); }
+		#endif
+		};
+
+		/// Sine for bulk evaluation.
+		struct math_sin
+		{
+			/// Double-precision reference.
+			/// \param arg function argument
+			/// \return function value
+			static double reference(double arg) { return std::sin(arg); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Relative error bound of SIMD kernel.
+			/// \return error bound
+			static float error() { return 7.62939453e-6f; }
+
+			/// Arguments to use the reference for.
+			/// \param x function arguments
+			/// \return mask of arguments not handled by SIMD kernel
+			static __m128 special(__m128 x) { return _mm_cmpnlt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), x), _mm_set1_ps(65536.0f)); }
+
+			/// SIMD kernel.
+			/// \param x function arguments
+			/// \return function values
+			static __m128 eval(__m128 x) { return sincos_sse2(x, 0); }
+		#endif
+		};
+
+		/// Cosine for bulk evaluation.
+		struct math_cos
+		{
+			/// Double-precision reference.
+			/// \param arg function argument
+			/// \return function value
+			static double reference(double arg) { return std::cos(arg); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Relative error bound of SIMD kernel.
+			/// \return error bound
+			static float error() { return 7.62939453e-6f; }
+
+			/// Arguments to use the reference for.
+			/// \param x function arguments
+			/// \return mask of arguments not handled by SIMD kernel
+			static __m128 special(__m128 x) { return math_sin::special(x); }
+
+			/// SIMD kernel.
+			/// \param x function arguments
+			/// \return function values
+			static __m128 eval(__m128 x) { return sincos_sse2(x, 1); }
+		#endif
+		};
+
+		/// Hyperbolic tangent for bulk evaluation.
+		struct math_tanh
+		{
+			/// Double-precision reference.
+			/// \param arg function argument
+			/// \return function value
+			static double reference(double arg) { return std::tanh(arg); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Relative error bound of SIMD kernel.
+			/// \return error bound
+			static float error() { return 7.62939453e-6f; }
+
+			/// Arguments to use the reference for.
+			/// \param x function arguments
+			/// \return mask of arguments not handled by SIMD kernel
+			static __m128 special(__m128 x) { return _mm_cmpunord_ps(x, x); }
+
+			/// SIMD kernel.
+			/// This uses a minimax polynomial for small arguments and `1-2/(exp(2x)+1)` for larger ones, clamped to where the 
+			/// result rounds to 1.
+			/// \param x function arguments
+			/// \return function values
+			static __m128 eval(__m128 x)
+			{
+				static const float c[] = { -4.047964138e-02f, 1.304667691e-01f, -3.331535593e-01f };
+				__m128 sign = _mm_and_ps(x, _mm_set1_ps(-0.0f)), ax = _mm_min_ps(_mm_andnot_ps(sign, x), _mm_set1_ps(9.0f)), t = _mm_mul_ps(ax, ax);
+				__m128 ypoly = _mm_add_ps(ax, _mm_mul_ps(_mm_mul_ps(ax, t), poly_sse2(t, c, 3))), one = _mm_set1_ps(1.0f);
+				__m128 yexp = _mm_sub_ps(one, _mm_div_ps(_mm_set1_ps(2.0f), _mm_add_ps(exp_sse2(_mm_add_ps(ax, ax)), one)));
+				return _mm_or_ps(_mm_castsi128_ps(select(_mm_castps_si128(_mm_cmplt_ps(ax, _mm_set1_ps(0.625f))), 
+					_mm_castps_si128(ypoly), _mm_castps_si128(yexp))), sign);
+			}
+		#endif
+		};
+
+		/// Logistic sigmoid for bulk evaluation.
+		struct math_sigmoid
+		{
+			/// Double-precision reference.
+			/// \param arg function argument
+			/// \return function value
+			static double reference(double arg) { return 1.0 / (1.0+std::exp(-arg)); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Relative error bound of SIMD kernel.
+			/// \return error bound
+			static float error() { return 1.52587891e-5f; }
+
+			/// Arguments to use the reference for.
+			/// \param x function arguments
+			/// \return mask of arguments not handled by SIMD kernel
+			static __m128 special(__m128 x) { return _mm_cmpunord_ps(x, x); }
+
+			/// SIMD kernel.
+			/// Arguments are clamped to where the result is too small for half-precision in any rounding mode or rounds to 1 in 
+			/// single-precision. Like the reference it underflows to 0 below -709.78.
+			/// \param x function arguments
+			/// \return function values
+			static __m128 eval(__m128 x)
+			{
+				__m128 e = exp_sse2(_mm_min_ps(_mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), x), _mm_set1_ps(-18.0f)), _mm_set1_ps(18.0f)));
+				return _mm_andnot_ps(_mm_cmplt_ps(x, _mm_set1_ps(-709.75f)), _mm_div_ps(_mm_set1_ps(1.0f), _mm_add_ps(_mm_set1_ps(1.0f), e)));
+			}
+		#endif
+		};
+
+		/// \name Array expressions
+		/// \{
+
+		/// Maximum number of elements array expressions are evaluated at once.
+		HALF_CONSTEXPR_CONST std::size_t array_block = 256;
+
+		/// Base class of lazy half-precision array expressions.
+		/// Array expressions don't compute anything until assigned to a [half_span](\ref half_float::half_span). They are 
+		/// then evaluated blockwise into single-precision buffers of #array_block elements and each block is rounded to 
+		/// half-precision only once at the end. Every expression type \a E provides a `size()` returning its number of 
+		/// elements and an `eval(i, n, out)` computing the elements `[i, i+n)` into the single-precision array \a out for 
+		/// any \a n of at most #array_block.
+		/// \tparam E type of actual expression
+		template<typename E> struct array_expr
+		{
+			/// Access actual expression.
+			/// \return reference to derived expression
+			const E& self() const { return static_cast<const E&>(*this); }
+		};
+
+		/// Scalar operand of array expressions.
+		/// This behaves like an array of arbitrary size with all elements equal.
+		struct array_scalar : array_expr<array_scalar>
+		{
+			/// Constructor.
+			/// \param value value of all elements
+			explicit array_scalar(float value) : value_(value) {}
+
+			/// Number of elements.
+			/// \return largest possible size, so that the other operand determines the size
+			std::size_t size() const { return std::numeric_limits<std::size_t>::max(); }
+
+			/// Value of elements.
+			/// \return element value
+			float value() const { return value_; }
+
+			/// Evaluate elements.
+			/// \param n number of elements to evaluate
+			/// \param out array to store elements into
+			void eval(std::size_t, std::size_t n, float *out) const { std::fill(out, out+n, value_); }
+
+		private:
+			/// Element value.
+			float value_;
+		};
+
+		/// Unary array expression.
+		/// \tparam F operation with a static `float apply(float)`
+		/// \tparam E type of operand
+		template<typename F,typename E> struct array_unary : array_expr<array_unary<F,E> >
+		{
+			/// Constructor.
+			/// \param arg operand
+			explicit array_unary(const E &arg) : arg_(arg) {}
+
+			/// Number of elements.
+			/// \return size of operand
+			std::size_t size() const { return arg_.size(); }
+
+			/// Evaluate elements.
+			/// \param i index of first element to evaluate
+			/// \param n number of elements to evaluate
+			/// \param out array to store elements into
+			void eval(std::size_t i, std::size_t n, float *out) const
+			{
+				std::size_t j = 0;
+				arg_.eval(i, n, out);
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				for(; j+4<=n; j+=4)
+					_mm_storeu_ps(out+j, F::apply(_mm_loadu_ps(out+j)));
+			#endif
+				for(; j<n; ++j)
+					out[j] = F::apply(out[j]);
+			}
+
+		private:
+			/// Operand.
+			E arg_;
+		};
+
+		/// Binary array expression.
+		/// \tparam F operation with a static `float apply(float, float)`
+		/// \tparam L type of left operand
+		/// \tparam R type of right operand
+		template<typename F,typename L,typename R> struct array_binary : array_expr<array_binary<F,L,R> >
+		{
+			/// Constructor.
+			/// \param lhs left operand
+			/// \param rhs right operand
+			array_binary(const L &lhs, const R &rhs) : lhs_(lhs), rhs_(rhs) {}
+
+			/// Number of elements.
+			/// \return size of shorter operand
+			std::size_t size() const { return std::min(lhs_.size(), rhs_.size()); }
+
+			/// Evaluate elements.
+			/// \param i index of first element to evaluate
+			/// \param n number of elements to evaluate
+			/// \param out array to store elements into
+			void eval(std::size_t i, std::size_t n, float *out) const { eval(lhs_, rhs_, i, n, out); }
+
+		private:
+			/// Evaluate elements of two array operands.
+			/// \param lhs left operand
+			/// \param rhs right operand
+			/// \param i index of first element to evaluate
+			/// \param n number of elements to evaluate
+			/// \param out array to store elements into
+			template<typename X,typename Y> static void eval(const X &lhs, const Y &rhs, std::size_t i, std::size_t n, float *out)
+			{
+				float y[array_block];
+				std::size_t j = 0;
+				lhs.eval(i, n, out);
+				rhs.eval(i, n, y);
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				for(; j+4<=n; j+=4)
+					_mm_storeu_ps(out+j, F::apply(_mm_loadu_ps(out+j), _mm_loadu_ps(y+j)));
+			#endif
+				for(; j<n; ++j)
+					out[j] = F::apply(out[j], y[j]);
+			}
+
+			/// Evaluate elements of array and scalar operand.
+			/// \param lhs left operand
+			/// \param rhs right operand
+			/// \param i index of first element to evaluate
+			/// \param n number of elements to evaluate
+			/// \param out array to store elements into
+			template<typename X> static void eval(const X &lhs, const array_scalar &rhs, std::size_t i, std::size_t n, float *out)
+			{
+				float y = rhs.value();
+				std::size_t j = 0;
+				lhs.eval(i, n, out);
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				for(__m128 vy=_mm_set1_ps(y); j+4<=n; j+=4)
+					_mm_storeu_ps(out+j, F::apply(_mm_loadu_ps(out+j), vy));
+			#endif
+				for(; j<n; ++j)
+					out[j] = F::apply(out[j], y);
+			}
+
+			/// Evaluate elements of scalar and array operand.
+			/// \param lhs left operand
+			/// \param rhs right operand
+			/// \param i index of first element to evaluate
+			/// \param n number of elements to evaluate
+			/// \param out array to store elements into
+			template<typename Y> static void eval(const array_scalar &lhs, const Y &rhs, std::size_t i, std::size_t n, float *out)
+			{
+				float x = lhs.value();
+				std::size_t j = 0;
+				rhs.eval(i, n, out);
+			#if HALF_ENABLE_SSE2_INTRINSICS
+				for(__m128 vx=_mm_set1_ps(x); j+4<=n; j+=4)
+					_mm_storeu_ps(out+j, F::apply(vx, _mm_loadu_ps(out+j)));
+			#endif
+				for(; j<n; ++j)
+					out[j] = F::apply(x, out[j]);
+			}
+
+			/// Left operand.
+			L lhs_;
+
+			/// Right operand.
+			R rhs_;
+		};
+
+		/// Addition for array expressions.
+		struct array_plus
+		{
+			static float apply(float x, float y) { return x + y; }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			static __m128 apply(__m128 x, __m128 y) { return _mm_add_ps(x, y); }
+		#endif
+		};
+
+		/// Subtraction for array expressions.
+		struct array_minus
+		{
+			static float apply(float x, float y) { return x - y; }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			static __m128 apply(__m128 x, __m128 y) { return _mm_sub_ps(x, y); }
+		#endif
+		};
+
+		/// Multiplication for array expressions.
+		struct array_multiplies
+		{
+			static float apply(float x, float y) { return x * y; }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			static __m128 apply(__m128 x, __m128 y) { return _mm_mul_ps(x, y); }
+		#endif
+		};
+
+		/// Division for array expressions.
+		struct array_divides
+		{
+			static float apply(float x, float y) { return x / y; }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			static __m128 apply(__m128 x, __m128 y) { return _mm_div_ps(x, y); }
+		#endif
+		};
+
+		/// Negation for array expressions.
+		struct array_negate
+		{
+			static float apply(float arg) { return -arg; }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			static __m128 apply(__m128 arg) { return _mm_xor_ps(arg, _mm_set1_ps(-0.0f)); }
+		#endif
+		};
+
+		/// Absolute value for array expressions.
+		struct array_abs
+		{
+			static float apply(float arg) { return std::fabs(arg); }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			static __m128 apply(__m128 arg) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), arg); }
+		#endif
+		};
+
+		/// Square root for array expressions.
+		struct array_sqrt
+		{
+			static float apply(float arg) { return std::sqrt(arg); }
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			static __m128 apply(__m128 arg) { return _mm_sqrt_ps(arg); }
+		#endif
+		};
+
+		/// Evaluate array expression.
+		/// Since each block of the expression is completely evaluated before any of it is stored, the destination may be 
+		/// one of the operands, as long as it doesn't partially overlap any of them.
+		/// \tparam R rounding mode to use
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \tparam X type of expression
+		/// \param expr expression to evaluate
+		/// \param dst array to store results into
+		/// \param n number of elements to evaluate
+		template<std::float_round_style R,bool E,typename X> void array_assign(const X &expr, half *dst, std::size_t n)
+		{
+			float buffer[array_block];
+			for(std::size_t i=0; i<n; i+=array_block)
+			{
+				std::size_t m = std::min(n-i, array_block);
+				expr.eval(i, m, buffer);
+				bulk::float2half<R,E,false>(buffer, dst+i, m);
+			}
+		}
+
+		/// \}
+
+		/// \name Matrix multiplication
+		/// \{
+
+		/// Portable register block for matrix multiplication.
+		/// Each register block computes the product of a packed panel of `mr` rows of the left matrix and a packed panel 
+		/// of `nr` columns of the right matrix, accumulating each element sequentially over the shared dimension.
+		struct gemm_kernel
+		{
+			enum { mr = 4, nr = 8 };
+
+			/// Multiply panels.
+			/// \param kc length of shared dimension
+			/// \param a panel of left matrix, column by column
+			/// \param b panel of right matrix, row by row
+			/// \param c block of products to add results to
+			/// \param ldc distance between rows of \a c in elements
+			static void run(std::size_t kc, const float *a, const float *b, float *c, std::size_t ldc)
+			{
+				float acc[mr][nr] = { { 0.0f } };
+				for(std::size_t p=0; p<kc; ++p, a+=mr, b+=nr)
+					for(int i=0; i<mr; ++i)
+						for(int j=0; j<nr; ++j)
+							acc[i][j] += a[i] * b[j];
+				for(int i=0; i<mr; ++i)
+					for(int j=0; j<nr; ++j)
+						c[i*ldc+j] += acc[i][j];
+			}
+		};
+
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		/// SSE2 register block for matrix multiplication.
+		/// This computes the same sums as the portable register block.
+		struct gemm_kernel_sse2
+		{
+			enum { mr = 4, nr = 8 };
+
+			/// Multiply panels.
+			/// \param kc length of shared dimension
+			/// \param a panel of left matrix, column by column
+			/// \param b panel of right matrix, row by row
+			/// \param c block of products to add results to
+			/// \param ldc distance between rows of \a c in elements
+			static void run(std::size_t kc, const float *a, const float *b, float *c, std::size_t ldc)
+			{
+				__m128 c00 = _mm_setzero_ps(), c01 = _mm_setzero_ps(), c10 = _mm_setzero_ps(), c11 = _mm_setzero_ps();
+				__m128 c20 = _mm_setzero_ps(), c21 = _mm_setzero_ps(), c30 = _mm_setzero_ps(), c31 = _mm_setzero_ps();
+				for(std::size_t p=0; p<kc; ++p, a+=mr, b+=nr)
+				{
+					__m128 b0 = _mm_loadu_ps(b), b1 = _mm_loadu_ps(b+4), x = _mm_set1_ps(a[0]);
+					c00 = _mm_add_ps(c00, _mm_mul_ps(x, b0));
+					c01 = _mm_add_ps(c01, _mm_mul_ps(x, b1));
+					x = _mm_set1_ps(a[1]);
+					c10 = _mm_add_ps(c10, _mm_mul_ps(x, b0));
+					c11 = _mm_add_ps(c11, _mm_mul_ps(x, b1));
+					x = _mm_set1_ps(a[2]);
+					c20 = _mm_add_ps(c20, _mm_mul_ps(x, b0));
+					c21 = _mm_add_ps(c21, _mm_mul_ps(x, b1));
+					x = _mm_set1_ps(a[3]);
+					c30 = _mm_add_ps(c30, _mm_mul_ps(x, b0));
+					c31 = _mm_add_ps(c31, _mm_mul_ps(x, b1));
+				}
+				store(c, c00, c01);
+				store(c+ldc, c10, c11);
+				store(c+2*ldc, c20, c21);
+				store(c+3*ldc, c30, c31);
+			}
+
+		private:
+			/// Add row of register block to products.
+			/// \param c row of products
+			/// \param lo sums of first 4 columns
+			/// \param hi sums of last 4 columns
+			static void store(float *c, __m128 lo, __m128 hi)
+			{
+				_mm_storeu_ps(c, _mm_add_ps(_mm_loadu_ps(c), lo));
+				_mm_storeu_ps(c+4, _mm_add_ps(_mm_loadu_ps(c+4), hi));
+			}
+		};
+	#endif
+
+	#if HALF_ENABLE_F16C_INTRINSICS
+		/// AVX register block for matrix multiplication.
+		/// This computes the same sums as the portable register block, using 12 of the 16 AVX registers for accumulators.
+		struct gemm_kernel_avx
+		{
+			enum { mr = 6, nr = 16 };
+
+			/// Multiply panels.
+			/// \param kc length of shared dimension
+			/// \param a panel of left matrix, column by column
+			/// \param b panel of right matrix, row by row
+			/// \param c block of products to add results to
+			/// \param ldc distance between rows of \a c in elements
+			static HALF_TARGET("avx") void run(std::size_t kc, const float *a, const float *b, float *c, std::size_t ldc)
+			{
+				__m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps(), c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+				__m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps(), c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+				__m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps(), c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+				for(std::size_t p=0; p<kc; ++p, a+=mr, b+=nr)
+				{
+					__m256 b0 = _mm256_loadu_ps(b), b1 = _mm256_loadu_ps(b+8), x = _mm256_broadcast_ss(a);
+					c00 = _mm256_add_ps(c00, _mm256_mul_ps(x, b0));
+					c01 = _mm256_add_ps(c01, _mm256_mul_ps(x, b1));
+					x = _mm256_broadcast_ss(a+1);
+					c10 = _mm256_add_ps(c10, _mm256_mul_ps(x, b0));
+					c11 = _mm256_add_ps(c11, _mm256_mul_ps(x, b1));
+					x = _mm256_broadcast_ss(a+2);
+					c20 = _mm256_add_ps(c20, _mm256_mul_ps(x, b0));
+					c21 = _mm256_add_ps(c21, _mm256_mul_ps(x, b1));
+					x = _mm256_broadcast_ss(a+3);
+					c30 = _mm256_add_ps(c30, _mm256_mul_ps(x, b0));
+					c31 = _mm256_add_ps(c31, _mm256_mul_ps(x, b1));
+					x = _mm256_broadcast_ss(a+4);
+					c40 = _mm256_add_ps(c40, _mm256_mul_ps(x, b0));
+					c41 = _mm256_add_ps(c41, _mm256_mul_ps(x, b1));
+					x = _mm256_broadcast_ss(a+5);
+					c50 = _mm256_add_ps(c50, _mm256_mul_ps(x, b0));
+					c51 = _mm256_add_ps(c51, _mm256_mul_ps(x, b1));
+				}
+				store(c, c00, c01);
+				store(c+ldc, c10, c11);
+				store(c+2*ldc, c20, c21);
+				store(c+3*ldc, c30, c31);
+				store(c+4*ldc, c40, c41);
+				store(c+5*ldc, c50, c51);
+			}
+
+		private:
+			/// Add row of register block to products.
+			/// \param c row of products
+			/// \param lo sums of first 8 columns
+			/// \param hi sums of last 8 columns
+			static HALF_TARGET("avx") void store(float *c, __m256 lo, __m256 hi)
+			{
+				_mm256_storeu_ps(c, _mm256_add_ps(_mm256_loadu_ps(c), lo));
+				_mm256_storeu_ps(c+8, _mm256_add_ps(_mm256_loadu_ps(c+8), hi));
+			}
+		};
+	#endif
+
+		/// Blocking of half-precision matrix multiplication.
+		/// The right matrix is packed into single-precision column panels of `nr` columns that together take at most 2 MiB, 
+		/// which are then multiplied with blocks of 72 rows of the left matrix, packed into single-precision row panels of 
+		/// `mr` rows for each 256 columns. Each block of rows accumulates its products in a single-precision buffer, which 
+		/// is rounded to half-precision only after the whole shared dimension has been processed. Since the sum for each 
+		/// element is always accumulated in the same order, results don't depend on the number of threads.
+		/// \tparam K register block to use
+		/// \tparam R rounding mode to use
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		template<typename K,std::float_round_style R,bool E> struct gemm_blocking
+		{
+			enum { mc = 72, kc = 256 };
+
+			/// Initialize.
+			/// \param m number of rows of \a a and \a c
+			/// \param n number of columns of \a b and \a c
+			/// \param k number of columns of \a a and rows of \a b
+			/// \param alpha factor for matrix product
+			/// \param a row-major left matrix
+			/// \param lda distance between rows of \a a in elements
+			/// \param b row-major right matrix
+			/// \param ldb distance between rows of \a b in elements
+			/// \param beta factor for \a c
+			/// \param c row-major matrix to add to and store results into
+			/// \param ldc distance between rows of \a c in elements
+			gemm_blocking(std::size_t m, std::size_t n, std::size_t k, float alpha, const half *a, std::size_t lda, 
+				const half *b, std::size_t ldb, float beta, half *c, std::size_t ldc) : m_(m), n_(n), k_(k), jc_(0), nc_(0), 
+				np_(0), alpha_(alpha), beta_(beta), a_(a), lda_(lda), b_(b), ldb_(ldb), c_(c), ldc_(ldc), panels_(NULL) {}
+
+			/// Compute matrix product.
+			void run()
+			{
+				if(!m_ || !n_)
+					return;
+				std::size_t nc = std::min(std::max((std::size_t(1)<<19)/std::max(k_, std::size_t(1)), std::size_t(K::nr)), n_);
+				std::size_t blocks = (m_+mc-1) / mc, chunk = (static_cast<double>(m_)*n_*k_ < 1e6) ? blocks : 1;
+				std::vector<float> panels(((nc+K::nr-1)/K::nr) * K::nr * k_);
+				panels_ = panels.empty() ? NULL : &panels[0];
+				for(jc_=0; jc_<n_; jc_+=nc_)
+				{
+					nc_ = std::min(n_-jc_, nc);
+					np_ = (nc_+K::nr-1) / K::nr * K::nr;
+					parallel_for(k_, false, pack(*this), (chunk == 1) ? std::max(parallel_chunk/np_, std::size_t(1)) : std::max(k_, std::size_t(1)));
+					parallel_for(blocks, false, multiply(*this), chunk);
+				}
+			}
+
+			/// Packing of rows of the right matrix.
+			struct pack
+			{
+				/// Initialize.
+				/// \param gemm matrix product to pack for
+				explicit pack(const gemm_blocking &gemm) : gemm_(gemm) {}
+
+				/// Pack rows into column panels.
+				/// \param begin index of first row
+				/// \param end index after last row
+				void operator()(std::size_t begin, std::size_t end) const
+				{
+					std::vector<float> row(gemm_.np_, 0.0f);
+					for(std::size_t p=begin; p<end; ++p)
+					{
+						bulk::half2float(gemm_.b_+p*gemm_.ldb_+gemm_.jc_, &row[0], gemm_.nc_);
+						for(std::size_t j=0; j<gemm_.np_; j+=K::nr)
+							std::memcpy(gemm_.panels_+j*gemm_.k_+p*K::nr, &row[j], K::nr*sizeof(float));
+					}
+				}
+
+			private:
+				const gemm_blocking &gemm_;
+			};
+
+			/// Multiplication of blocks of rows of the left matrix.
+			struct multiply
+			{
+				/// Initialize.
+				/// \param gemm matrix product to compute
+				explicit multiply(const gemm_blocking &gemm) : gemm_(gemm) {}
+
+				/// Multiply blocks of rows with packed panels.
+				/// \param begin index of first block
+				/// \param end index after last block
+				void operator()(std::size_t begin, std::size_t end) const
+				{
+					std::size_t np = gemm_.np_, k = gemm_.k_;
+					std::vector<float> packed(mc*kc), sums(mc*np), row(std::max(std::size_t(kc), np));
+					for(std::size_t blk=begin; blk<end; ++blk)
+					{
+						std::size_t ic = blk * mc, rows = std::min(gemm_.m_-ic, std::size_t(mc)), mp = (rows+K::mr-1) / K::mr * K::mr;
+						std::fill(sums.begin(), sums.end(), 0.0f);
+						for(std::size_t pc=0; pc<k; pc+=kc)
+						{
+							std::size_t depth = std::min(k-pc, std::size_t(kc));
+							for(std::size_t i=0; i<mp; ++i)
+							{
+								float *dst = &packed[(i/K::mr)*K::mr*depth+i%K::mr];
+								if(i < rows)
+									bulk::half2float(gemm_.a_+(ic+i)*gemm_.lda_+pc, &row[0], depth);
+								else
+									std::fill(row.begin(), row.begin()+depth, 0.0f);
+								for(std::size_t p=0; p<depth; ++p)
+									dst[p*K::mr] = row[p];
+							}
+							for(std::size_t jr=0; jr<np; jr+=K::nr)
+								for(std::size_t ir=0; ir<mp; ir+=K::mr)
+									K::run(depth, &packed[ir*depth], gemm_.panels_+jr*k+pc*K::nr, &sums[ir*np+jr], np);
+						}
+						for(std::size_t i=0; i<rows; ++i)
+						{
+							float *acc = &sums[i*np];
+							half *dst = gemm_.c_ + (ic+i)*gemm_.ldc_ + gemm_.jc_;
+							if(gemm_.beta_ != 0.0f)
+							{
+								bulk::half2float(dst, &row[0], gemm_.nc_);
+								for(std::size_t j=0; j<gemm_.nc_; ++j)
+									acc[j] = gemm_.alpha_*acc[j] + gemm_.beta_*row[j];
+							}
+							else
+								for(std::size_t j=0; j<gemm_.nc_; ++j)
+									acc[j] *= gemm_.alpha_;
+							bulk::float2half<R,E,false>(acc, dst, gemm_.nc_);
+						}
+					}
+				}
+
+			private:
+				const gemm_blocking &gemm_;
+			};
+
+			std::size_t m_, n_, k_, jc_, nc_, np_;
+			float alpha_, beta_;
+			const half *a_;
+			std::size_t lda_;
+			const half *b_;
+			std::size_t ldb_;
+			half *c_;
+			std::size_t ldc_;
+			float *panels_;
+		};
+
+		/// Half-precision matrix-vector product.
+		/// The vector is converted to single-precision only once, and the rows are then multiplied with it in chunks that 
+		/// are spread over the threads of the pool for large matrices. Each row is accumulated like dot(), so results don't 
+		/// depend on the number of threads.
+		/// \tparam T type to accumulate in, `float` or `double`
+		/// \tparam R rounding mode to use
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		template<typename T,std::float_round_style R,bool E> struct gemv_blocking
+		{
+			/// Initialize.
+			/// \param m number of rows
+			/// \param n number of columns
+			/// \param alpha factor for matrix-vector product
+			/// \param a row-major matrix
+			/// \param lda distance between rows of \a a in elements
+			/// \param x vector of \a n elements to multiply with
+			/// \param beta factor for \a y
+			/// \param y vector of \a m elements to add to and store results into
+			gemv_blocking(std::size_t m, std::size_t n, T alpha, const half *a, std::size_t lda, const half *x, T beta, half *y)
+				: m_(m), n_(n), alpha_(alpha), beta_(beta), a_(a), lda_(lda), x_(x), y_(y), vector_(NULL) {}
+
+			/// Compute matrix-vector product.
+			void run()
+			{
+				std::vector<float> vector(n_);
+				vector_ = vector.empty() ? NULL : &vector[0];
+				bulk::half2float(x_, vector_, n_);
+				parallel_for(m_, false, *this, std::max(parallel_chunk/std::max(n_, std::size_t(1)), std::size_t(1)));
+			}
+
+			/// Multiply rows with vector.
+			/// \param begin index of first row
+			/// \param end index after last row
+			void operator()(std::size_t begin, std::size_t end) const
+			{
+				bulk::gemv<T,R,E>(end-begin, n_, alpha_, a_+begin*lda_, lda_, vector_, beta_, y_+begin);
+			}
+
+		private:
+			std::size_t m_, n_;
+			T alpha_, beta_;
+			const half *a_;
+			std::size_t lda_;
+			const half *x_;
+			half *y_;
+			float *vector_;
+		};
+
+		/// \}
+
+		/// \name Reductions
+		/// \{
+
+		/// Sum of single-precision values.
+		/// This accumulates 8 interleaved partial sums, which are added pairwise at the end.
+		/// \tparam Q `true` for summing squares, `false` for summing values
+		/// \param x values to sum
+		/// \param n number of values
+		/// \return sum of values or their squares
+		template<bool Q> float block_sum(const float *x, std::size_t n)
+		{
+			float sum[8] = { 0.0f };
+			std::size_t i = 0;
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			__m128 lo = _mm_setzero_ps(), hi = _mm_setzero_ps();
+			for(; i+8<=n; i+=8)
+			{
+				__m128 a = _mm_loadu_ps(x+i), b = _mm_loadu_ps(x+i+4);
+				lo = _mm_add_ps(lo, Q ? _mm_mul_ps(a, a) : a);
+				hi = _mm_add_ps(hi, Q ? _mm_mul_ps(b, b) : b);
+			}
+			_mm_storeu_ps(sum, lo);
+			_mm_storeu_ps(sum+4, hi);
+		#endif
+			for(; i<n; ++i)
+				sum[i&7] += Q ? (x[i]*x[i]) : x[i];
+			return ((sum[0]+sum[4])+(sum[1]+sum[5])) + ((sum[2]+sum[6])+(sum[3]+sum[7]));
+		}
+
+		/// Sum of squared deviations of single-precision values.
+		/// \param x values
+		/// \param n number of values
+		/// \param mean value to compute deviations from
+		/// \return sum of squared deviations from \a mean
+		inline float block_deviation(const float *x, std::size_t n, float mean)
+		{
+			float sum[8] = { 0.0f };
+			std::size_t i = 0;
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			__m128 lo = _mm_setzero_ps(), hi = _mm_setzero_ps(), m = _mm_set1_ps(mean);
+			for(; i+8<=n; i+=8)
+			{
+				__m128 a = _mm_sub_ps(_mm_loadu_ps(x+i), m), b = _mm_sub_ps(_mm_loadu_ps(x+i+4), m);
+				lo = _mm_add_ps(lo, _mm_mul_ps(a, a));
+				hi = _mm_add_ps(hi, _mm_mul_ps(b, b));
+			}
+			_mm_storeu_ps(sum, lo);
+			_mm_storeu_ps(sum+4, hi);
+		#endif
+			for(; i<n; ++i)
+				sum[i&7] += (x[i]-mean) * (x[i]-mean);
+			return ((sum[0]+sum[4])+(sum[1]+sum[5])) + ((sum[2]+sum[6])+(sum[3]+sum[7]));
+		}
+
+		/// Compensated single-precision sum.
+		/// This uses Neumaier's variant of Kahan summation, so the result is nearly as accurate as if accumulated exactly 
+		/// and rounded only once.
+		struct compensated_sum
+		{
+			/// Construct zero sum.
+			compensated_sum() : sum(0.0f), error(0.0f) {}
+
+			/// Add value.
+			/// \param x value to add
+			void add(float x)
+			{
+				float s = sum + x;
+				error += (std::fabs(sum) >= std::fabs(x)) ? ((sum-s)+x) : ((x-s)+sum);
+				sum = s;
+			}
+
+			/// Add other sum.
+			/// \param x sum to add
+			void add(const compensated_sum &x)
+			{
+				add(x.sum);
+				error += x.error;
+			}
+
+			/// Compensated value.
+			/// \return sum corrected by accumulated rounding errors, unless infinite or NaN
+			float value() const { return (sum-sum == 0.0f) ? (sum+error) : sum; }
+
+			/// Uncompensated sum.
+			float sum;
+
+			/// Accumulated rounding errors.
+			float error;
+		};
+
+		/// Sum of half-precision values.
+		/// Blocks of 256 values are converted to single-precision and summed in SIMD registers, and the block sums are 
+		/// accumulated with compensation.
+		/// \tparam Q `true` for summing squares, `false` for summing values
+		template<bool Q> struct sum_reduction
+		{
+			typedef compensated_sum state;
+
+			/// Reduce chunk.
+			/// \param s state to accumulate into
+			/// \param data values to sum
+			/// \param n number of values
+			static void chunk(state &s, const half *data, std::size_t n, std::size_t)
+			{
+				float buffer[256];
+				for(std::size_t i=0; i<n; i+=256)
+				{
+					std::size_t m = std::min(n-i, std::size_t(256));
+					bulk::half2float(data+i, buffer, m);
+					s.add(block_sum<Q>(buffer, m));
+				}
+			}
+
+			/// Combine results of consecutive chunks.
+			/// \param s result of first chunk to accumulate into
+			/// \param t result of second chunk
+			static void merge(state &s, const state &t) { s.add(t); }
+		};
+
+		/// Mean and sum of squared deviations of half-precision values.
+		/// Each block of 256 values computes its mean and squared deviations from it in two passes over the L1 cache and 
+		/// the blocks are combined using the pairwise update of Chan et al.
+		struct variance_reduction
+		{
+			/// Statistics of values.
+			struct state
+			{
+				/// Construct empty statistics.
+				state() : count(0), mean(0.0f), m2(0.0f) {}
+
+				/// Number of values.
+				std::size_t count;
+
+				/// Mean of values.
+				float mean;
+
+				/// Sum of squared deviations from mean.
+				float m2;
+			};
+
+			/// Reduce chunk.
+			/// \param s state to accumulate into
+			/// \param data values to sum
+			/// \param n number of values
+			static void chunk(state &s, const half *data, std::size_t n, std::size_t)
+			{
+				float buffer[256];
+				for(std::size_t i=0; i<n; i+=256)
+				{
+					state t;
+					t.count = std::min(n-i, std::size_t(256));
+					bulk::half2float(data+i, buffer, t.count);
+					t.mean = block_sum<false>(buffer, t.count) / static_cast<float>(t.count);
+					t.m2 = block_deviation(buffer, t.count, t.mean);
+					merge(s, t);
+				}
+			}
+
+			/// Combine results of consecutive chunks.
+			/// \param s result of first chunk to accumulate into
+			/// \param t result of second chunk
+			static void merge(state &s, const state &t)
+			{
+				if(!s.count)
+				{
+					s = t;
+					return;
+				}
+				if(!t.count)
+					return;
+				std::size_t count = s.count + t.count;
+				float delta = t.mean - s.mean, f = static_cast<float>(t.count) / static_cast<float>(count);
+				s.mean += delta * f;
+				s.m2 += t.m2 + delta*delta*static_cast<float>(s.count)*f;
+				s.count = count;
+			}
+		};
+
+		/// Extremum of half-precision values.
+		/// \tparam M `true` for maximum, `false` for minimum
+		template<bool M> struct extremum_reduction
+		{
+			/// Extremum found so far.
+			struct state
+			{
+				/// Construct empty result.
+				state() : key(M ? INT_MIN : INT_MAX), index(0) {}
+
+				/// Ordered integer key of extremum.
+				int key;
+
+				/// Index of first occurrence of extremum.
+				std::size_t index;
+			};
+
+			/// Reduce chunk.
+			/// \param s state to store result into
+			/// \param data values to search
+			/// \param n number of values
+			/// \param offset index of first value in whole array
+			static void chunk(state &s, const half *data, std::size_t n, std::size_t offset) { s.index = offset + bulk::extremum<M>(data, n, s.key); }
+
+			/// Combine results of consecutive chunks.
+			/// \param s result of first chunk to update
+			/// \param t result of second chunk
+			static void merge(state &s, const state &t)
+			{
+				if(M ? (t.key > s.key) : (t.key < s.key))
+					s = t;
+			}
+		};
+
+		/// Reduction of one chunk of a half-precision array.
+		/// \tparam F reduction to perform
+		template<typename F> struct reduce_chunk
+		{
+			/// Initialize.
+			/// \param data array to reduce
+			/// \param states array of results for each chunk
+			reduce_chunk(const half *data, typename F::state *states) : data_(data), states_(states) {}
+
+			/// Reduce chunk.
+			/// \param begin index of first element
+			/// \param end index after last element
+			void operator()(std::size_t begin, std::size_t end) const { F::chunk(states_[begin/parallel_chunk], data_+begin, end-begin, begin); }
+
+		private:
+			const half *data_;
+			typename F::state *states_;
+		};
+
+		/// Reduce half-precision array.
+		/// The array is reduced in chunks of #parallel_chunk elements, whose results are always combined in order, so the 
+		/// result doesn't depend on the number of threads used.
+		/// \tparam F reduction to perform
+		/// \param data array to reduce
+		/// \param n number of elements
+		/// \param parallel `true` for reducing chunks in parallel, `false` for reducing in the calling thread
+		/// \return result of reduction
+		template<typename F> typename F::state reduce(const half *data, std::size_t n, bool parallel)
+		{
+			typename F::state result;
+			if(parallel && n > parallel_chunk)
+			{
+				std::vector<typename F::state> states((n+parallel_chunk-1)/parallel_chunk);
+				parallel_for(n, false, reduce_chunk<F>(data, &states[0]));
+				for(std::size_t c=0; c<states.size(); ++c)
+					F::merge(result, states[c]);
+			}
+			else
+				for(std::size_t i=0; i<n; i+=parallel_chunk)
+				{
+					typename F::state state;
+					F::chunk(state, data+i, std::min(n-i, parallel_chunk), i);
+					F::merge(result, state);
+				}
+			return result;
+		}
+
+		/// \}
+
+		/// \name Exact accumulation
+		/// \{
+
+		/// Exact accumulator for sums of halfs and their products.
+		/// Every finite half is a multiple of 2^-24 and every product of two halfs a multiple of 2^-48 smaller than 2^80. 
+		/// So these are summed exactly in a 128-bit fixed-point integer with 48 fractional bits, which is rounded only once 
+		/// when converting the result. Since integer addition is associative, the result doesn't depend on the order in 
+		/// which values are added or accumulators are combined. At least 2^47 products or 2^63 halfs can be added without 
+		/// overflowing.
+		///
+		/// An exactly zero result is always positive zero. Any NaN, infinities of opposite sign or infinity multiplied by 
+		/// zero make the result NaN, and otherwise any infinity makes it infinite.
+		class exact_accumulator
+		{
+		public:
+			/// Construct zero accumulator.
+			exact_accumulator() : lo_(0), hi_(0), special_(0) {}
+
+			/// Add half-precision value.
+			/// \param x value to add
+			/// \return reference to this accumulator
+			exact_accumulator& operator+=(half x) { add_value(static_cast<float>(x)); return *this; }
+
+			/// Add other accumulator.
+			/// \param other accumulator whose sum to add
+			/// \return reference to this accumulator
+			exact_accumulator& operator+=(const exact_accumulator &other)
+			{
+				lo_ += other.lo_;
+				hi_ += other.hi_ + (lo_ < other.lo_);
+				special_ |= other.special_;
+				return *this;
+			}
+
+			/// Add product of half-precision values.
+			/// \param x first factor
+			/// \param y second factor
+			/// \return reference to this accumulator
+			exact_accumulator& add_product(half x, half y) { add_value(static_cast<float>(x)*static_cast<float>(y)); return *this; }
+
+			/// Add half-precision array.
+			/// This sums the significands of all elements with the same sign and exponent in integer registers and only 
+			/// shifts these sums into the fixed-point sum at the end, so it runs at the speed of integer additions.
+			/// \param data array to add
+			/// \param n number of elements
+			/// \return reference to this accumulator
+			exact_accumulator& add(const half *data, std::size_t n)
+			{
+				static const std::size_t block = 1 << 24;
+				for(std::size_t i=0; i<n; i+=block)
+				{
+					uint64 sums[256] = { 0 };
+					bulk::exponent_sums(data+i, std::min(n-i, block), sums);
+					for(unsigned int j=0; j<64; ++j)
+					{
+						uint64 count = (sums[j]>>32) + (sums[j+64]>>32) + (sums[j+128]>>32) + (sums[j+192]>>32);
+						uint64 m = (sums[j]&0xFFFFFFFF) + (sums[j+64]&0xFFFFFFFF) + (sums[j+128]&0xFFFFFFFF) + (sums[j+192]&0xFFFFFFFF);
+						unsigned int e = j & 0x1F;
+						if(e != 0x1F)
+							add_scaled(e ? (m+(count<<10)) : m, static_cast<int>(e+(e==0))+23, (j&0x20) != 0);
+						else if(count)
+							special_ |= m ? 4 : (j&0x20) ? 2 : 1;
+					}
+				}
+				return *this;
+			}
+
+			/// Add products of half-precision arrays.
+			/// Like add(), this sums the integral products of significands with the same sign and exponent sum in integer 
+			/// registers and only shifts these into the fixed-point sum at the end.
+			/// \param x first array
+			/// \param y second array
+			/// \param n number of elements
+			/// \return reference to this accumulator
+			exact_accumulator& add_products(const half *x, const half *y, std::size_t n)
+			{
+				static const std::size_t block = 1 << 24;
+				for(std::size_t i=0; i<n; i+=block)
+				{
+					uint64 sums[512] = { 0 };
+					special_ |= bulk::exponent_products(x+i, y+i, std::min(n-i, block), sums);
+					for(unsigned int j=0; j<128; ++j)
+						add_scaled(sums[j]+sums[j+128]+sums[j+256]+sums[j+384], static_cast<int>(j&0x3F)-2, (j&0x40) != 0);
+				}
+				return *this;
+			}
+
+			/// Rounded value of sum.
+			/// The exact sum is rounded only once, to nearest for `float` and `double` and using the default rounding mode 
+			/// for `half`, as by half_cast().
+			/// \tparam T type to return, `half`, `float` or `double`
+			/// \return sum rounded to \a T
+			template<typename T> T value() const
+			{
+				if(special_)
+					return (special_ > 2) ? std::numeric_limits<T>::quiet_NaN() : (special_ == 1) ? 
+						std::numeric_limits<T>::infinity() : -std::numeric_limits<T>::infinity();
+				bool negative = (hi_>>63) != 0;
+				uint64 lo = negative ? (~lo_+1) : lo_, hi = negative ? (~hi_+(lo==0)) : hi_;
+				int exp = -48;
+				if(hi)
+				{
+					int k = 1;
+					for(; k<64 && (hi>>k); ++k) ;
+					lo = (k<64) ? ((hi<<(64-k)) | (lo>>k) | ((lo<<(64-k)) != 0)) : (hi | (lo!=0));
+					exp += k;
+				}
+				return rounded(lo, exp, negative, T());
+			}
+
+		private:
+			typedef bits<double>::type uint64;
+
+			/// Add scaled integer.
+			/// \param m integer to add
+			/// \param exp power of two to multiply with in units of 2^-48, may only be negative if exactly divisible
+			/// \param negative `true` to subtract, `false` to add
+			void add_scaled(uint64 m, int exp, bool negative)
+			{
+				if(!m)
+					return;
+				uint64 lo = (exp<0) ? (m>>-exp) : (m<<exp), hi = (exp>0) ? (m>>(64-exp)) : 0;
+				if(negative)
+				{
+					hi_ -= hi + (lo_ < lo);
+					lo_ -= lo;
+				}
+				else
+				{
+					lo_ += lo;
+					hi_ += hi + (lo_ < lo);
+				}
+			}
+
+			/// Add single-precision value that is a multiple of 2^-48.
+			/// \param x value to add
+			void add_value(float x)
+			{
+				if(x != x)
+					special_ |= 4;
+				else if(std::fabs(x) > std::numeric_limits<float>::max())
+					special_ |= (x < 0.0f) ? 2 : 1;
+				else if(x != 0.0f)
+				{
+					int exp;
+					float m = std::frexp(x, &exp);
+					add_scaled(static_cast<uint64>(std::ldexp(std::fabs(m), 24)), exp+24, x < 0.0f);
+				}
+			}
+
+			/// Round to floating-point.
+			/// \tparam T floating-point type to round to
+			/// \param m integer with at least 2 more bits than \a T, whose least significant bit is set if inexact
+			/// \param exp exponent of \a m
+			/// \param negative `true` for negative value, `false` for positive
+			/// \return rounded value
+			template<typename T> static T rounded(uint64 m, int exp, bool negative, T)
+			{
+				T value = std::ldexp(static_cast<T>(m), exp);
+				return negative ? -value : value;
+			}
+
+			/// Round to half-precision.
+			/// This rounds to odd double-precision first, which is exact for rounding to half-precision afterwards.
+			/// \param m integer whose least significant bit is set if inexact
+			/// \param exp exponent of \a m
+			/// \param negative `true` for negative value, `false` for positive
+			/// \return rounded value
+			static half rounded(uint64 m, int exp, bool negative, half)
+			{
+				for(; m>>53; ++exp)
+					m = (m>>1) | (m&1);
+				double value = std::ldexp(static_cast<double>(m), exp);
+				return half_caster<half,double>::cast(negative ? -value : value);
+			}
+
+			/// Lower 64 bits of two's complement fixed-point sum.
+			uint64 lo_;
+
+			/// Upper 64 bits of two's complement fixed-point sum.
+			uint64 hi_;
+
+			/// Bit mask of non-finite values, 1 for positive infinity, 2 for negative infinity and 4 for NaN.
+			unsigned int special_;
+		};
+
+		/// Exact accumulation of chunks of half-precision arrays.
+		struct exact_chunk
+		{
+			/// Initialize.
+			/// \param x array to sum
+			/// \param y array to multiply with or `NULL` for summing \a x
+			/// \param states array of accumulators for each chunk
+			exact_chunk(const half *x, const half *y, exact_accumulator *states) : x_(x), y_(y), states_(states) {}
+
+			/// Accumulate chunk.
+			/// \param begin index of first element
+			/// \param end index after last element
+			void operator()(std::size_t begin, std::size_t end) const
+			{
+				if(y_)
+					states_[begin/parallel_chunk].add_products(x_+begin, y_+begin, end-begin);
+				else
+					states_[begin/parallel_chunk].add(x_+begin, end-begin);
+			}
+
+		private:
+			const half *x_;
+			const half *y_;
+			exact_accumulator *states_;
+		};
+
+		/// Exactly accumulate half-precision array or products of arrays.
+		/// \param x array to sum
+		/// \param y array to multiply with or `NULL` for summing \a x
+		/// \param n number of elements
+		/// \param parallel `true` for accumulating chunks in parallel, `false` for accumulating in the calling thread
+		/// \return exact sum
+		inline exact_accumulator exact_accumulate(const half *x, const half *y, std::size_t n, bool parallel)
+		{
+			exact_accumulator result;
+			if(parallel && n > parallel_chunk)
+			{
+				std::vector<exact_accumulator> states((n+parallel_chunk-1)/parallel_chunk);
+				parallel_for(n, false, exact_chunk(x, y, &states[0]));
+				for(std::size_t c=0; c<states.size(); ++c)
+					result += states[c];
+			}
+			else if(y)
+				result.add_products(x, y, n);
+			else
+				result.add(x, n);
+			return result;
+		}
+
+		/// \}
+
+		/// \name Sorting
+		/// \{
+
+		/// Sort 16-bit keys and values.
+		/// This is a stable least significant digit radix sort with two byte-wise passes, skipping a pass if all keys have 
+		/// the same byte there.
+		/// \tparam T value type
+		/// \param keys keys to sort
+		/// \param values values to reorder like the keys, `NULL` for only sorting keys
+		/// \param n number of elements
+		template<typename T> void radix_sort(uint16 *keys, T *values, std::size_t n)
+		{
+			if(n < 2)
+				return;
+			std::size_t count[2][256] = { { 0 } };
+			for(std::size_t i=0; i<n; ++i)
+			{
+				++count[0][keys[i]&0xFF];
+				++count[1][keys[i]>>8];
+			}
+			std::vector<uint16> key_buffer(n);
+			std::vector<T> value_buffer(values ? n : 0);
+			uint16 *key_src = keys, *key_dst = &key_buffer[0];
+			T *value_src = values, *value_dst = values ? &value_buffer[0] : NULL;
+			for(unsigned int pass=0, shift=0; pass<2; ++pass, shift+=8)
+			{
+				std::size_t *offset = count[pass];
+				if(offset[(key_src[0]>>shift)&0xFF] == n)
+					continue;
+				for(std::size_t b=0, sum=0; b<256; ++b)
+				{
+					std::size_t c = offset[b];
+					offset[b] = sum;
+					sum += c;
+				}
+				for(std::size_t i=0; i<n; ++i)
+				{
+					std::size_t pos = offset[(key_src[i]>>shift)&0xFF]++;
+					key_dst[pos] = key_src[i];
+					if(values)
+						value_dst[pos] = value_src[i];
+				}
+				std::swap(key_src, key_dst);
+				std::swap(value_src, value_dst);
+			}
+			if(key_src != keys)
+			{
+				std::copy(key_src, key_src+n, keys);
+				if(values)
+					std::copy(value_src, value_src+n, values);
+			}
+		}
+
+		/// Sort 16-bit keys.
+		/// Large arrays are sorted by counting the occurrences of all 65536 keys, smaller ones using radix_sort().
+		/// \param keys keys to sort
+		/// \param n number of keys
+		inline void sort_keys(uint16 *keys, std::size_t n)
+		{
+			if(n < 0x10000)
+				return radix_sort(keys, static_cast<uint16*>(NULL), n);
+			std::vector<std::size_t> count(0x10000);
+			for(std::size_t i=0; i<n; ++i)
+				++count[keys[i]];
+			for(std::size_t key=0; key<0x10000; keys+=count[key++])
+				std::fill_n(keys, count[key], static_cast<uint16>(key));
+		}
+
+		/// Select smallest 16-bit keys.
+		/// This moves the \a k smallest keys to the front, keeping the order of both the selected and the remaining keys. 
+		/// Of keys equal to the largest selected key, the first ones are selected. The threshold is found using two 
+		/// byte-wise histograms.
+		/// \tparam T value type
+		/// \param keys keys to select from
+		/// \param values values to reorder like the keys, `NULL` for only selecting keys
+		/// \param n number of elements
+		/// \param k number of keys to select, in [1, \a n]
+		template<typename T> void select_keys(uint16 *keys, T *values, std::size_t n, std::size_t k)
+		{
+			std::size_t count[256] = { 0 }, below = 0;
+			for(std::size_t i=0; i<n; ++i)
+				++count[keys[i]>>8];
+			unsigned int hi = 0;
+			for(; below+count[hi]<k; ++hi)
+				below += count[hi];
+			std::fill(count, count+256, std::size_t());
+			for(std::size_t i=0; i<n; ++i)
+				if((keys[i]>>8) == hi)
+					++count[keys[i]&0xFF];
+			unsigned int lo = 0;
+			for(; below+count[lo]<k; ++lo)
+				below += count[lo];
+			unsigned int threshold = (hi<<8) | lo;
+			std::size_t equal = k - below, j = 0;
+			std::vector<uint16> rest_keys;
+			std::vector<T> rest_values;
+			rest_keys.reserve(n-k);
+			if(values)
+				rest_values.reserve(n-k);
+			for(std::size_t i=0; i<n; ++i)
+			{
+				bool select = keys[i] < threshold || (keys[i] == threshold && equal);
+				if(select)
+				{
+					equal -= (keys[i] == threshold);
+					keys[j] = keys[i];
+					if(values)
+						values[j] = values[i];
+					++j;
+				}
+				else
+				{
+					rest_keys.push_back(keys[i]);
+					if(values)
+						rest_values.push_back(values[i]);
+				}
+			}
+			std::copy(rest_keys.begin(), rest_keys.end(), keys+k);
+			if(values)
+				std::copy(rest_values.begin(), rest_values.end(), values+k);
+		}
+
+		/// \}
+
+		/// \name Histograms
+		/// \{
+
+		/// Histogram of chunks of a half-precision array.
+		struct histogram_chunk
+		{
+			/// Initialize.
+			/// \param data array to count
+			/// \param counts sets of 65536 counters for each chunk
+			/// \param chunk number of elements per chunk
+			histogram_chunk(const half *data, std::size_t *counts, std::size_t chunk) : data_(data), counts_(counts), chunk_(chunk) {}
+
+			/// Count chunk.
+			/// \param begin index of first element
+			/// \param end index after last element
+			void operator()(std::size_t begin, std::size_t end) const { bulk::histogram(data_+begin, end-begin, counts_+((begin/chunk_)<<16)); }
+
+		private:
+			const half *data_;
+			std::size_t *counts_;
+			std::size_t chunk_;
+		};
+
+		/// Exact histogram of half-precision values.
+		/// Since there are only 65536 different halfs, this simply counts every single binary representation, which makes 
+		/// all statistics derived from it exact. The counters are kept in the order of sort(), so quantiles only need a 
+		/// single pass over them instead of sorting the data. Different binary representations are counted separately, so 
+		/// negative zero and positive zero are different values for count() and mode(), but NaNs are not counted as values 
+		/// for any of the statistics.
+		class half_histogram
+		{
+		public:
+			/// Construct empty histogram.
+			half_histogram() : counts_(0x10000), size_(0) {}
+
+			/// Construct histogram of half-precision array.
+			/// \param data array to count
+			/// \param n number of elements
+			half_histogram(const half *data, std::size_t n) : counts_(0x10000), size_(0) { add(data, n); }
+
+			/// Count half-precision value.
+			/// \param x value to count
+			/// \return reference to this histogram
+			half_histogram& operator+=(half x) { return add(&x, 1); }
+
+			/// Add counts of other histogram.
+			/// \param other histogram to add
+			/// \return reference to this histogram
+			half_histogram& operator+=(const half_histogram &other)
+			{
+				for(std::size_t i=0; i<0x10000; ++i)
+					counts_[i] += other.counts_[i];
+				size_ += other.size_;
+				return *this;
+			}
+
+			/// Count half-precision array.
+			/// \param data array to count
+			/// \param n number of elements
+			/// \return reference to this histogram
+			half_histogram& add(const half *data, std::size_t n)
+			{
+				bulk::histogram(data, n, &counts_[0]);
+				size_ += n;
+				return *this;
+			}
+
+			/// Count half-precision array using multiple threads.
+			/// Each thread of the pool configured by set_parallel_threads() counts one contiguous part of the array into 
+			/// its own sub-histogram, which are added up at the end. So the result is exactly the same as from add().
+			/// \param data array to count
+			/// \param n number of elements
+			/// \return reference to this histogram
+			half_histogram& add_parallel(const half *data, std::size_t n)
+			{
+				std::size_t parts = std::min(static_cast<std::size_t>(parallel_threads()), n>>18);
+				if(parts < 2)
+					return add(data, n);
+				std::size_t chunk = (n+parts-1) / parts;
+				std::vector<std::size_t> counts((n+chunk-1)/chunk<<16);
+				parallel_for(n, true, histogram_chunk(data, &counts[0], chunk), chunk);
+				for(std::size_t i=0; i<counts.size(); ++i)
+					counts_[i&0xFFFF] += counts[i];
+				size_ += n;
+				return *this;
+			}
+
+			/// Total number of counted values.
+			/// \return number of counted values including NaNs
+			std::size_t size() const { return size_; }
+
+			/// Number of NaNs.
+			/// \return number of counted NaNs
+			std::size_t nan_count() const { return size_ - values(); }
+
+			/// Number of occurrences of value.
+			/// \param x value to look up
+			/// \return number of counted values with the same binary representation as \a x
+			std::size_t count(half x) const
+			{
+				uint16 key;
+				bulk::sort_keys(&x, &key, 1);
+				return counts_[key];
+			}
+
+			/// Smallest value.
+			/// \return smallest counted value, NaN if there are none
+			half minimum() const
+			{
+				for(unsigned int key=0; key<nan_key; ++key)
+					if(counts_[key])
+						return value(key);
+				return functions::nanh();
+			}
+
+			/// Largest value.
+			/// \return largest counted value, NaN if there are none
+			half maximum() const
+			{
+				for(unsigned int key=nan_key; key>0; --key)
+					if(counts_[key-1])
+						return value(key-1);
+				return functions::nanh();
+			}
+
+			/// Most frequent value.
+			/// \return most frequently counted value, the smallest one if several are equally frequent, NaN if there are none
+			half mode() const
+			{
+				unsigned int best = nan_key;
+				for(unsigned int key=0; key<nan_key; ++key)
+					if(counts_[key] && (best == nan_key || counts_[key] > counts_[best]))
+						best = key;
+				return (best == nan_key) ? functions::nanh() : value(best);
+			}
+
+			/// Quantile.
+			/// This computes the exact quantile as the smallest counted value that is greater than or equal to at least the 
+			/// given fraction of all counted values (the nearest-rank method), so it is always one of the counted values.
+			/// \param q fraction of values in [0, 1], e.g. 0.999 for the 99.9th percentile
+			/// \return smallest value with at least `ceil(q*n)` values smaller or equal, NaN if there are no values or \a q is NaN
+			half quantile(double q) const
+			{
+				std::size_t n = values();
+				if(!n || builtin_isnan(q))
+					return functions::nanh();
+				double rank = std::ceil(q*static_cast<double>(n));
+				std::size_t r = (rank < 1.0) ? 1 : (rank >= static_cast<double>(n)) ? n : static_cast<std::size_t>(rank);
+				unsigned int key = 0;
+				for(std::size_t sum=counts_[0]; sum<r; sum+=counts_[++key]) ;
+				return value(key);
+			}
+
+			/// Cumulative distribution function.
+			/// \param x value to evaluate distribution at
+			/// \return fraction of counted values smaller than or equal to \a x, NaN if \a x is NaN or there are no values
+			double cdf(half x) const
+			{
+				uint16 key;
+				bulk::sort_keys(&x, &key, 1);
+				std::size_t n = values();
+				if(key >= nan_key || !n)
+					return std::numeric_limits<double>::quiet_NaN();
+				if(key == zero_key-1)
+					++key;
+				std::size_t sum = 0;
+				for(unsigned int k=0; k<=key; ++k)
+					sum += counts_[k];
+				return static_cast<double>(sum) / static_cast<double>(n);
+			}
+
+		private:
+			/// Sort key of first NaN.
+			static const unsigned int nan_key = 0xF802;
+
+			/// Sort key of positive zero.
+			static const unsigned int zero_key = 0x7C01;
+
+			/// Number of counted values that are not NaN.
+			/// \return number of non-NaN values
+			std::size_t values() const
+			{
+				std::size_t n = size_;
+				for(unsigned int key=nan_key; key<0x10000; ++key)
+					n -= counts_[key];
+				return n;
+			}
+
+			/// Value of sort key.
+			/// \param key sort key
+			/// \return half-precision value
+			static half value(unsigned int key)
+			{
+				uint16 k = static_cast<uint16>(key);
+				half x;
+				bulk::sort_values(&k, &x, 1);
+				return x;
+			}
+
+			/// Counters indexed by sort key.
+			std::vector<std::size_t> counts_;
+
+			/// Total number of counted values.
+			std::size_t size_;
+		};
+
+		/// \}
+
+		/// \name Comparison operators
+		/// \{
+
+		/// Comparison for equality.
+		/// \param x first operand
+		/// \param y second operand
+		/// \retval true if operands equal
+		/// \retval false else
+		template<typename T,typename U> typename enable<bool,T,U>::type operator==(T x, U y) { return functions::isequal(x, y); }
+
+		/// Comparison for inequality.
+		/// \param x first operand
+		/// \param y second operand
+		/// \retval true if operands not equal
+		/// \retval false else
+		template<typename T,typename U> typename enable<bool,T,U>::type operator!=(T x, U y) { return functions::isnotequal(x, y); }
+
+		/// Comparison for less than.
+		/// \param x first operand
+		/// \param y second operand
+		/// \retval true if \a x less than \a y
+		/// \retval false else
+		template<typename T,typename U> typename enable<bool,T,U>::type operator<(T x, U y) { return functions::isless(x, y); }
+
+		/// Comparison for greater than.
+		/// \param x first operand
+		/// \param y second operand
+		/// \retval true if \a x greater than \a y
+		/// \retval false else
+		template<typename T,typename U> typename enable<bool,T,U>::type operator>(T x, U y) { return functions::isgreater(x, y); }
+
+		/// Comparison for less equal.
+		/// \param x first operand
+		/// \param y second operand
+		/// \retval true if \a x less equal \a y
+		/// \retval false else
+		template<typename T,typename U> typename enable<bool,T,U>::type operator<=(T x, U y) { return functions::islessequal(x, y); }
+
+		/// Comparison for greater equal.
+		/// \param x first operand
+		/// \param y second operand
+		/// \retval true if \a x greater equal \a y
+		/// \retval false else
+		template<typename T,typename U> typename enable<bool,T,U>::type operator>=(T x, U y) { return functions::isgreaterequal(x, y); }
+
+		/// \}
+		/// \name Arithmetic operators
+		/// \{
+
+		/// Add halfs.
+		/// \param x left operand
+		/// \param y right operand
+		/// \return sum of half expressions
+		template<typename T,typename U> typename enable<expr,T,U>::type operator+(T x, U y) { return functions::plus(x, y); }
 
 		/// Subtract halfs.
 		/// \param x left operand
@@ -2168,692 +6905,2314 @@ namespace half_float
 		/// \return difference of half expressions
 		template<typename T,typename U> typename enable<expr,T,U>::type operator-(T x, U y) { return functions::minus(x, y); }
 
-		/// Multiply halfs.
-		/// \param x left operand
-		/// \param y right operand
-		/// \return product of half expressions
-		template<typename T,typename U> typename enable<expr,T,U>::type operator*(T x, U y) { return functions::multiplies(x, y); }
+		/// Multiply halfs.
+		/// \param x left operand
+		/// \param y right operand
+		/// \return product of half expressions
+		template<typename T,typename U> typename enable<expr,T,U>::type operator*(T x, U y) { return functions::multiplies(x, y); }
+
+		/// Divide halfs.
+		/// \param x left operand
+		/// \param y right operand
+		/// \return quotient of half expressions
+		template<typename T,typename U> typename enable<expr,T,U>::type operator/(T x, U y) { return functions::divides(x, y); }
+
+		/// Identity.
+		/// \param arg operand
+		/// \return uncahnged operand
+		template<typename T> HALF_CONSTEXPR typename enable<T,T>::type operator+(T arg) { return arg; }
+
+		/// Negation.
+		/// \param arg operand
+		/// \return negated operand
+		template<typename T> HALF_CONSTEXPR typename enable<T,T>::type operator-(T arg) { return unary_specialized<T>::negate(arg); }
+
+		/// \}
+		/// \name Input and output
+		/// \{
+
+		/// Output operator.
+		/// \param out output stream to write into
+		/// \param arg half expression to write
+		/// \return reference to output stream
+		template<typename T,typename charT,typename traits> typename enable<std::basic_ostream<charT,traits>&,T>::type
+			operator<<(std::basic_ostream<charT,traits> &out, T arg) { return functions::write(out, arg); }
+
+		/// Input operator.
+		/// \param in input stream to read from
+		/// \param arg half to read into
+		/// \return reference to input stream
+		template<typename charT,typename traits> std::basic_istream<charT,traits>&
+			operator>>(std::basic_istream<charT,traits> &in, half &arg) { return functions::read(in, arg); }
+
+		/// \}
+		/// \name Basic mathematical operations
+		/// \{
+
+		/// Absolute value.
+		/// \param arg operand
+		/// \return absolute value of \a arg
+//		template<typename T> typename enable<T,T>::type abs(T arg) { return unary_specialized<T>::fabs(arg); }
+		inline half abs(half arg) { return unary_specialized<half>::fabs(arg); }
+		inline expr abs(expr arg) { return unary_specialized<expr>::fabs(arg); }
+
+		/// Absolute value.
+		/// \param arg operand
+		/// \return absolute value of \a arg
+//		template<typename T> typename enable<T,T>::type fabs(T arg) { return unary_specialized<T>::fabs(arg); }
+		inline half fabs(half arg) { return unary_specialized<half>::fabs(arg); }
+		inline expr fabs(expr arg) { return unary_specialized<expr>::fabs(arg); }
+
+		/// Remainder of division.
+		/// \param x first operand
+		/// \param y second operand
+		/// \return remainder of floating point division.
+//		template<typename T,typename U> typename enable<expr,T,U>::type fmod(T x, U y) { return functions::fmod(x, y); }
+		inline expr fmod(half x, half y) { return functions::fmod(x, y); }
+		inline expr fmod(half x, expr y) { return functions::fmod(x, y); }
+		inline expr fmod(expr x, half y) { return functions::fmod(x, y); }
+		inline expr fmod(expr x, expr y) { return functions::fmod(x, y); }
+
+		/// Remainder of division.
+		/// \param x first operand
+		/// \param y second operand
+		/// \return remainder of floating point division.
+//		template<typename T,typename U> typename enable<expr,T,U>::type remainder(T x, U y) { return functions::remainder(x, y); }
+		inline expr remainder(half x, half y) { return functions::remainder(x, y); }
+		inline expr remainder(half x, expr y) { return functions::remainder(x, y); }
+		inline expr remainder(expr x, half y) { return functions::remainder(x, y); }
+		inline expr remainder(expr x, expr y) { return functions::remainder(x, y); }
+
+		/// Remainder of division.
+		/// \param x first operand
+		/// \param y second operand
+		/// \param quo address to store some bits of quotient at
+		/// \return remainder of floating point division.
+//		template<typename T,typename U> typename enable<expr,T,U>::type remquo(T x, U y, int *quo) { return functions::remquo(x, y, quo); }
+		inline expr remquo(half x, half y, int *quo) { return functions::remquo(x, y, quo); }
+		inline expr remquo(half x, expr y, int *quo) { return functions::remquo(x, y, quo); }
+		inline expr remquo(expr x, half y, int *quo) { return functions::remquo(x, y, quo); }
+		inline expr remquo(expr x, expr y, int *quo) { return functions::remquo(x, y, quo); }
+
+		/// Fused multiply add.
+		/// \param x first operand
+		/// \param y second operand
+		/// \param z third operand
+		/// \return ( \a x * \a y ) + \a z rounded as one operation.
+//		template<typename T,typename U,typename V> typename enable<expr,T,U,V>::type fma(T x, U y, V z) { return functions::fma(x, y, z); }
+		inline expr fma(half x, half y, half z) { return functions::fma(x, y, z); }
+		inline expr fma(half x, half y, expr z) { return functions::fma(x, y, z); }
+		inline expr fma(half x, expr y, half z) { return functions::fma(x, y, z); }
+		inline expr fma(half x, expr y, expr z) { return functions::fma(x, y, z); }
+		inline expr fma(expr x, half y, half z) { return functions::fma(x, y, z); }
+		inline expr fma(expr x, half y, expr z) { return functions::fma(x, y, z); }
+		inline expr fma(expr x, expr y, half z) { return functions::fma(x, y, z); }
+		inline expr fma(expr x, expr y, expr z) { return functions::fma(x, y, z); }
+
+		/// Maximum of half expressions.
+		/// \param x first operand
+		/// \param y second operand
+		/// \return maximum of operands
+//		template<typename T,typename U> typename result<T,U>::type fmax(T x, U y) { return binary_specialized<T,U>::fmax(x, y); }
+		inline half fmax(half x, half y) { return binary_specialized<half,half>::fmax(x, y); }
+		inline expr fmax(half x, expr y) { return binary_specialized<half,expr>::fmax(x, y); }
+		inline expr fmax(expr x, half y) { return binary_specialized<expr,half>::fmax(x, y); }
+		inline expr fmax(expr x, expr y) { return binary_specialized<expr,expr>::fmax(x, y); }
+
+		/// Minimum of half expressions.
+		/// \param x first operand
+		/// \param y second operand
+		/// \return minimum of operands
+//		template<typename T,typename U> typename result<T,U>::type fmin(T x, U y) { return binary_specialized<T,U>::fmin(x, y); }
+		inline half fmin(half x, half y) { return binary_specialized<half,half>::fmin(x, y); }
+		inline expr fmin(half x, expr y) { return binary_specialized<half,expr>::fmin(x, y); }
+		inline expr fmin(expr x, half y) { return binary_specialized<expr,half>::fmin(x, y); }
+		inline expr fmin(expr x, expr y) { return binary_specialized<expr,expr>::fmin(x, y); }
+
+		/// Positive difference.
+		/// \param x first operand
+		/// \param y second operand
+		/// \return \a x - \a y or 0 if difference negative
+//		template<typename T,typename U> typename enable<expr,T,U>::type fdim(T x, U y) { return functions::fdim(x, y); }
+		inline expr fdim(half x, half y) { return functions::fdim(x, y); }
+		inline expr fdim(half x, expr y) { return functions::fdim(x, y); }
+		inline expr fdim(expr x, half y) { return functions::fdim(x, y); }
+		inline expr fdim(expr x, expr y) { return functions::fdim(x, y); }
+
+		/// Get NaN value.
+		/// \return quiet NaN
+		inline half nanh(const char*) { return functions::nanh(); }
+
+		/// \}
+		/// \name Exponential functions
+		/// \{
+
+		/// Exponential function.
+		/// \param arg function argument
+		/// \return e raised to \a arg
+//		template<typename T> typename enable<expr,T>::type exp(T arg) { return functions::exp(arg); }
+		inline expr exp(half arg) { return functions::exp(arg); }
+		inline expr exp(expr arg) { return functions::exp(arg); }
+
+		/// Exponential minus one.
+		/// \param arg function argument
+		/// \return e raised to \a arg subtracted by 1
+//		template<typename T> typename enable<expr,T>::type expm1(T arg) { return functions::expm1(arg); }
+		inline expr expm1(half arg) { return functions::expm1(arg); }
+		inline expr expm1(expr arg) { return functions::expm1(arg); }
+
+		/// Binary exponential.
+		/// \param arg function argument
+		/// \return 2 raised to \a arg
+//		template<typename T> typename enable<expr,T>::type exp2(T arg) { return functions::exp2(arg); }
+		inline expr exp2(half arg) { return functions::exp2(arg); }
+		inline expr exp2(expr arg) { return functions::exp2(arg); }
+
+		/// Natural logorithm.
+		/// \param arg function argument
+		/// \return logarithm of \a arg to base e
+//		template<typename T> typename enable<expr,T>::type log(T arg) { return functions::log(arg); }
+		inline expr log(half arg) { return functions::log(arg); }
+		inline expr log(expr arg) { return functions::log(arg); }
+
+		/// Common logorithm.
+		/// \param arg function argument
+		/// \return logarithm of \a arg to base 10
+//		template<typename T> typename enable<expr,T>::type log10(T arg) { return functions::log10(arg); }
+		inline expr log10(half arg) { return functions::log10(arg); }
+		inline expr log10(expr arg) { return functions::log10(arg); }
+
+		/// Natural logorithm.
+		/// \param arg function argument
+		/// \return logarithm of \a arg plus 1 to base e
+//		template<typename T> typename enable<expr,T>::type log1p(T arg) { return functions::log1p(arg); }
+		inline expr log1p(half arg) { return functions::log1p(arg); }
+		inline expr log1p(expr arg) { return functions::log1p(arg); }
+
+		/// Binary logorithm.
+		/// \param arg function argument
+		/// \return logarithm of \a arg to base 2
+//		template<typename T> typename enable<expr,T>::type log2(T arg) { return functions::log2(arg); }
+		inline expr log2(half arg) { return functions::log2(arg); }
+		inline expr log2(expr arg) { return functions::log2(arg); }
+
+		/// \}
+		/// \name Power functions
+		/// \{
+
+		/// Square root.
+		/// \param arg function argument
+		/// \return square root of \a arg
+//		template<typename T> typename enable<expr,T>::type sqrt(T arg) { return functions::sqrt(arg); }
+		inline expr sqrt(half arg) { return functions::sqrt(arg); }
+		inline expr sqrt(expr arg) { return functions::sqrt(arg); }
+
+		/// Cubic root.
+		/// \param arg function argument
+		/// \return cubic root of \a arg
+//		template<typename T> typename enable<expr,T>::type cbrt(T arg) { return functions::cbrt(arg); }
+		inline expr cbrt(half arg) { return functions::cbrt(arg); }
+		inline expr cbrt(expr arg) { return functions::cbrt(arg); }
+
+		/// Hypotenuse function.
+		/// \param x first argument
+		/// \param y second argument
+		/// \return square root of sum of squares without internal over- or underflows
+//		template<typename T,typename U> typename enable<expr,T,U>::type hypot(T x, U y) { return functions::hypot(x, y); }
+		inline expr hypot(half x, half y) { return functions::hypot(x, y); }
+		inline expr hypot(half x, expr y) { return functions::hypot(x, y); }
+		inline expr hypot(expr x, half y) { return functions::hypot(x, y); }
+		inline expr hypot(expr x, expr y) { return functions::hypot(x, y); }
+
+		/// Power function.
+		/// \param base first argument
+		/// \param exp second argument
+		/// \return \a base raised to \a exp
+//		template<typename T,typename U> typename enable<expr,T,U>::type pow(T base, U exp) { return functions::pow(base, exp); }
+		inline expr pow(half base, half exp) { return functions::pow(base, exp); }
+		inline expr pow(half base, expr exp) { return functions::pow(base, exp); }
+		inline expr pow(expr base, half exp) { return functions::pow(base, exp); }
+		inline expr pow(expr base, expr exp) { return functions::pow(base, exp); }
+
+		/// \}
+		/// \name Trigonometric functions
+		/// \{
+
+		/// Sine function.
+		/// \param arg function argument
+		/// \return sine value of \a arg
+//		template<typename T> typename enable<expr,T>::type sin(T arg) { return functions::sin(arg); }
+		inline expr sin(half arg) { return functions::sin(arg); }
+		inline expr sin(expr arg) { return functions::sin(arg); }
+
+		/// Cosine function.
+		/// \param arg function argument
+		/// \return cosine value of \a arg
+//		template<typename T> typename enable<expr,T>::type cos(T arg) { return functions::cos(arg); }
+		inline expr cos(half arg) { return functions::cos(arg); }
+		inline expr cos(expr arg) { return functions::cos(arg); }
+
+		/// Tangent function.
+		/// \param arg function argument
+		/// \return tangent value of \a arg
+//		template<typename T> typename enable<expr,T>::type tan(T arg) { return functions::tan(arg); }
+		inline expr tan(half arg) { return functions::tan(arg); }
+		inline expr tan(expr arg) { return functions::tan(arg); }
+
+		/// Arc sine.
+		/// \param arg function argument
+		/// \return arc sine value of \a arg
+//		template<typename T> typename enable<expr,T>::type asin(T arg) { return functions::asin(arg); }
+		inline expr asin(half arg) { return functions::asin(arg); }
+		inline expr asin(expr arg) { return functions::asin(arg); }
+
+		/// Arc cosine function.
+		/// \param arg function argument
+		/// \return arc cosine value of \a arg
+//		template<typename T> typename enable<expr,T>::type acos(T arg) { return functions::acos(arg); }
+		inline expr acos(half arg) { return functions::acos(arg); }
+		inline expr acos(expr arg) { return functions::acos(arg); }
+
+		/// Arc tangent function.
+		/// \param arg function argument
+		/// \return arc tangent value of \a arg
+//		template<typename T> typename enable<expr,T>::type atan(T arg) { return functions::atan(arg); }
+		inline expr atan(half arg) { return functions::atan(arg); }
+		inline expr atan(expr arg) { return functions::atan(arg); }
+
+		/// Arc tangent function.
+		/// \param x first argument
+		/// \param y second argument
+		/// \return arc tangent value
+//		template<typename T,typename U> typename enable<expr,T,U>::type atan2(T x, U y) { return functions::atan2(x, y); }
+		inline expr atan2(half x, half y) { return functions::atan2(x, y); }
+		inline expr atan2(half x, expr y) { return functions::atan2(x, y); }
+		inline expr atan2(expr x, half y) { return functions::atan2(x, y); }
+		inline expr atan2(expr x, expr y) { return functions::atan2(x, y); }
+
+		/// \}
+		/// \name Hyperbolic functions
+		/// \{
+
+		/// Hyperbolic sine.
+		/// \param arg function argument
+		/// \return hyperbolic sine value of \a arg
+//		template<typename T> typename enable<expr,T>::type sinh(T arg) { return functions::sinh(arg); }
+		inline expr sinh(half arg) { return functions::sinh(arg); }
+		inline expr sinh(expr arg) { return functions::sinh(arg); }
+
+		/// Hyperbolic cosine.
+		/// \param arg function argument
+		/// \return hyperbolic cosine value of \a arg
+//		template<typename T> typename enable<expr,T>::type cosh(T arg) { return functions::cosh(arg); }
+		inline expr cosh(half arg) { return functions::cosh(arg); }
+		inline expr cosh(expr arg) { return functions::cosh(arg); }
+
+		/// Hyperbolic tangent.
+		/// \param arg function argument
+		/// \return hyperbolic tangent value of \a arg
+//		template<typename T> typename enable<expr,T>::type tanh(T arg) { return functions::tanh(arg); }
+		inline expr tanh(half arg) { return functions::tanh(arg); }
+		inline expr tanh(expr arg) { return functions::tanh(arg); }
+
+		/// Hyperbolic area sine.
+		/// \param arg function argument
+		/// \return area sine value of \a arg
+//		template<typename T> typename enable<expr,T>::type asinh(T arg) { return functions::asinh(arg); }
+		inline expr asinh(half arg) { return functions::asinh(arg); }
+		inline expr asinh(expr arg) { return functions::asinh(arg); }
+
+		/// Hyperbolic area cosine.
+		/// \param arg function argument
+		/// \return area cosine value of \a arg
+//		template<typename T> typename enable<expr,T>::type acosh(T arg) { return functions::acosh(arg); }
+		inline expr acosh(half arg) { return functions::acosh(arg); }
+		inline expr acosh(expr arg) { return functions::acosh(arg); }
+
+		/// Hyperbolic area tangent.
+		/// \param arg function argument
+		/// \return area tangent value of \a arg
+//		template<typename T> typename enable<expr,T>::type atanh(T arg) { return functions::atanh(arg); }
+		inline expr atanh(half arg) { return functions::atanh(arg); }
+		inline expr atanh(expr arg) { return functions::atanh(arg); }
+
+		/// \}
+		/// \name Error and gamma functions
+		/// \{
+
+		/// Error function.
+		/// \param arg function argument
+		/// \return error function value of \a arg
+//		template<typename T> typename enable<expr,T>::type erf(T arg) { return functions::erf(arg); }
+		inline expr erf(half arg) { return functions::erf(arg); }
+		inline expr erf(expr arg) { return functions::erf(arg); }
+
+		/// Complementary error function.
+		/// \param arg function argument
+		/// \return 1 minus error function value of \a arg
+//		template<typename T> typename enable<expr,T>::type erfc(T arg) { return functions::erfc(arg); }
+		inline expr erfc(half arg) { return functions::erfc(arg); }
+		inline expr erfc(expr arg) { return functions::erfc(arg); }
+
+		/// Natural logarithm of gamma function.
+		/// \param arg function argument
+		/// \return natural logarith of gamma function for \a arg
+//		template<typename T> typename enable<expr,T>::type lgamma(T arg) { return functions::lgamma(arg); }
+		inline expr lgamma(half arg) { return functions::lgamma(arg); }
+		inline expr lgamma(expr arg) { return functions::lgamma(arg); }
+
+		/// Gamma function.
+		/// \param arg function argument
+		/// \return gamma function value of \a arg
+//		template<typename T> typename enable<expr,T>::type tgamma(T arg) { return functions::tgamma(arg); }
+		inline expr tgamma(half arg) { return functions::tgamma(arg); }
+		inline expr tgamma(expr arg) { return functions::tgamma(arg); }
+
+		/// \}
+		/// \name Rounding
+		/// \{
+
+		/// Nearest integer not less than half value.
+		/// \param arg half to round
+		/// \return nearest integer not less than \a arg
+//		template<typename T> typename enable<half,T>::type ceil(T arg) { return functions::ceil(arg); }
+		inline half ceil(half arg) { return functions::ceil(arg); }
+		inline half ceil(expr arg) { return functions::ceil(arg); }
+
+		/// Nearest integer not greater than half value.
+		/// \param arg half to round
+		/// \return nearest integer not greater than \a arg
+//		template<typename T> typename enable<half,T>::type floor(T arg) { return functions::floor(arg); }
+		inline half floor(half arg) { return functions::floor(arg); }
+		inline half floor(expr arg) { return functions::floor(arg); }
+
+		/// Nearest integer not greater in magnitude than half value.
+		/// \param arg half to round
+		/// \return nearest integer not greater in magnitude than \a arg
+//		template<typename T> typename enable<half,T>::type trunc(T arg) { return functions::trunc(arg); }
+		inline half trunc(half arg) { return functions::trunc(arg); }
+		inline half trunc(expr arg) { return functions::trunc(arg); }
+
+		/// Nearest integer.
+		/// \param arg half to round
+		/// \return nearest integer, rounded away from zero in half-way cases
+//		template<typename T> typename enable<half,T>::type round(T arg) { return functions::round(arg); }
+		inline half round(half arg) { return functions::round(arg); }
+		inline half round(expr arg) { return functions::round(arg); }
+
+		/// Nearest integer.
+		/// \param arg half to round
+		/// \return nearest integer, rounded away from zero in half-way cases
+//		template<typename T> typename enable<long,T>::type lround(T arg) { return functions::lround(arg); }
+		inline long lround(half arg) { return functions::lround(arg); }
+		inline long lround(expr arg) { return functions::lround(arg); }
+
+		/// Nearest integer using half's internal rounding mode.
+		/// \param arg half expression to round
+		/// \return nearest integer using default rounding mode
+//		template<typename T> typename enable<half,T>::type nearbyint(T arg) { return functions::nearbyint(arg); }
+		inline half nearbyint(half arg) { return functions::rint(arg); }
+		inline half nearbyint(expr arg) { return functions::rint(arg); }
+
+		/// Nearest integer using half's internal rounding mode.
+		/// \param arg half expression to round
+		/// \return nearest integer using default rounding mode
+//		template<typename T> typename enable<half,T>::type rint(T arg) { return functions::rint(arg); }
+		inline half rint(half arg) { return functions::rint(arg); }
+		inline half rint(expr arg) { return functions::rint(arg); }
+
+		/// Nearest integer using half's internal rounding mode.
+		/// \param arg half expression to round
+		/// \return nearest integer using default rounding mode
+//		template<typename T> typename enable<long,T>::type lrint(T arg) { return functions::lrint(arg); }
+		inline long lrint(half arg) { return functions::lrint(arg); }
+		inline long lrint(expr arg) { return functions::lrint(arg); }
+	#if HALF_ENABLE_CPP11_LONG_LONG
+		/// Nearest integer.
+		/// \param arg half to round
+		/// \return nearest integer, rounded away from zero in half-way cases
+//		template<typename T> typename enable<long long,T>::type llround(T arg) { return functions::llround(arg); }
+		inline long long llround(half arg) { return functions::llround(arg); }
+		inline long long llround(expr arg) { return functions::llround(arg); }
+
+		/// Nearest integer using half's internal rounding mode.
+		/// \param arg half expression to round
+		/// \return nearest integer using default rounding mode
+//		template<typename T> typename enable<long long,T>::type llrint(T arg) { return functions::llrint(arg); }
+		inline long long llrint(half arg) { return functions::llrint(arg); }
+		inline long long llrint(expr arg) { return functions::llrint(arg); }
+	#endif
+
+		/// \}
+		/// \name Floating point manipulation
+		/// \{
+
+		/// Decompress floating point number.
+		/// \param arg number to decompress
+		/// \param exp address to store exponent at
+		/// \return significant in range [0.5, 1)
+//		template<typename T> typename enable<half,T>::type frexp(T arg, int *exp) { return functions::frexp(arg, exp); }
+		inline half frexp(half arg, int *exp) { return functions::frexp(arg, exp); }
+		inline half frexp(expr arg, int *exp) { return functions::frexp(arg, exp); }
+
+		/// Multiply by power of two.
+		/// \param arg number to modify
+		/// \param exp power of two to multiply with
+		/// \return \a arg multplied by 2 raised to \a exp
+//		template<typename T> typename enable<half,T>::type ldexp(T arg, int exp) { return functions::scalbln(arg, exp); }
+		inline half ldexp(half arg, int exp) { return functions::scalbln(arg, exp); }
+		inline half ldexp(expr arg, int exp) { return functions::scalbln(arg, exp); }
+
+		/// Extract integer and fractional parts.
+		/// \param arg number to decompress
+		/// \param iptr address to store integer part at
+		/// \return fractional part
+//		template<typename T> typename enable<half,T>::type modf(T arg, half *iptr) { return functions::modf(arg, iptr); }
+		inline half modf(half arg, half *iptr) { return functions::modf(arg, iptr); }
+		inline half modf(expr arg, half *iptr) { return functions::modf(arg, iptr); }
 
-		/// Divide halfs.
-		/// \param x left operand
-		/// \param y right operand
-		/// \return quotient of half expressions
-		template<typename T,typename U> typename enable<expr,T,U>::type operator/(T x, U y) { return functions::divides(x, y); }
+		/// Multiply by power of two.
+		/// \param arg number to modify
+		/// \param exp power of two to multiply with
+		/// \return \a arg multplied by 2 raised to \a exp
+//		template<typename T> typename enable<half,T>::type scalbn(T arg, int exp) { return functions::scalbln(arg, exp); }
+		inline half scalbn(half arg, int exp) { return functions::scalbln(arg, exp); }
+		inline half scalbn(expr arg, int exp) { return functions::scalbln(arg, exp); }
 
-		/// Identity.
-		/// \param arg operand
-		/// \return uncahnged operand
-		template<typename T> HALF_CONSTEXPR typename enable<T,T>::type operator+(T arg) { return arg; }
+		/// Multiply by power of two.
+		/// \param arg number to modify
+		/// \param exp power of two to multiply with
+		/// \return \a arg multplied by 2 raised to \a exp	
+//		template<typename T> typename enable<half,T>::type scalbln(T arg, long exp) { return functions::scalbln(arg, exp); }
+		inline half scalbln(half arg, long exp) { return functions::scalbln(arg, exp); }
+		inline half scalbln(expr arg, long exp) { return functions::scalbln(arg, exp); }
 
-		/// Negation.
-		/// \param arg operand
-		/// \return negated operand
-		template<typename T> HALF_CONSTEXPR typename enable<T,T>::type operator-(T arg) { return unary_specialized<T>::negate(arg); }
+		/// Extract exponent.
+		/// \param arg number to query
+		/// \return floating point exponent
+		/// \retval FP_ILOGB0 for zero
+		/// \retval FP_ILOGBNAN for NaN
+		/// \retval MAX_INT for infinity
+//		template<typename T> typename enable<int,T>::type ilogb(T arg) { return functions::ilogb(arg); }
+		inline int ilogb(half arg) { return functions::ilogb(arg); }
+		inline int ilogb(expr arg) { return functions::ilogb(arg); }
 
-		/// \}
-		/// \name Input and output
-		/// \{
+		/// Extract exponent.
+		/// \param arg number to query
+		/// \return floating point exponent
+//		template<typename T> typename enable<half,T>::type logb(T arg) { return functions::logb(arg); }
+		inline half logb(half arg) { return functions::logb(arg); }
+		inline half logb(expr arg) { return functions::logb(arg); }
 
-		/// Output operator.
-		/// \param out output stream to write into
-		/// \param arg half expression to write
-		/// \return reference to output stream
-		template<typename T,typename charT,typename traits> typename enable<std::basic_ostream<charT,traits>&,T>::type
-			operator<<(std::basic_ostream<charT,traits> &out, T arg) { return functions::write(out, arg); }
+		/// Next representable value.
+		/// \param from value to compute next representable value for
+		/// \param to direction towards which to compute next value
+		/// \return next representable value after \a from in direction towards \a to
+//		template<typename T,typename U> typename enable<half,T,U>::type nextafter(T from, U to) { return functions::nextafter(from, to); }
+		inline half nextafter(half from, half to) { return functions::nextafter(from, to); }
+		inline half nextafter(half from, expr to) { return functions::nextafter(from, to); }
+		inline half nextafter(expr from, half to) { return functions::nextafter(from, to); }
+		inline half nextafter(expr from, expr to) { return functions::nextafter(from, to); }
 
-		/// Input operator.
-		/// \param in input stream to read from
-		/// \param arg half to read into
-		/// \return reference to input stream
-		template<typename charT,typename traits> std::basic_istream<charT,traits>&
-			operator>>(std::basic_istream<charT,traits> &in, half &arg) { return functions::read(in, arg); }
+		/// Next representable value.
+		/// \param from value to compute next representable value for
+		/// \param to direction towards which to compute next value
+		/// \return next representable value after \a from in direction towards \a to
+//		template<typename T> typename enable<half,T>::type nexttoward(T from, long double to) { return functions::nexttoward(from, to); }
+		inline half nexttoward(half from, long double to) { return functions::nexttoward(from, to); }
+		inline half nexttoward(expr from, long double to) { return functions::nexttoward(from, to); }
+
+		/// Take sign.
+		/// \param x value to change sign for
+		/// \param y value to take sign from
+		/// \return value equal to \a x in magnitude and to \a y in sign
+//		template<typename T,typename U> typename enable<half,T,U>::type copysign(T x, U y) { return functions::copysign(x, y); }
+		inline half copysign(half x, half y) { return functions::copysign(x, y); }
+		inline half copysign(half x, expr y) { return functions::copysign(x, y); }
+		inline half copysign(expr x, half y) { return functions::copysign(x, y); }
+		inline half copysign(expr x, expr y) { return functions::copysign(x, y); }
 
 		/// \}
-		/// \name Basic mathematical operations
+		/// \name Floating point classification
 		/// \{
 
-		/// Absolute value.
-		/// \param arg operand
-		/// \return absolute value of \a arg
-//		template<typename T> typename enable<T,T>::type abs(T arg) { return unary_specialized<T>::fabs(arg); }
-		inline half abs(half arg) { return unary_specialized<half>::fabs(arg); }
-		inline expr abs(expr arg) { return unary_specialized<expr>::fabs(arg); }
 
-		/// Absolute value.
-		/// \param arg operand
-		/// \return absolute value of \a arg
-//		template<typename T> typename enable<T,T>::type fabs(T arg) { return unary_specialized<T>::fabs(arg); }
-		inline half fabs(half arg) { return unary_specialized<half>::fabs(arg); }
-		inline expr fabs(expr arg) { return unary_specialized<expr>::fabs(arg); }
+		/// Classify floating point value.
+		/// \param arg number to classify
+		/// \retval FP_ZERO for positive and negative zero
+		/// \retval FP_SUBNORMAL for subnormal numbers
+		/// \retval FP_INFINITY for positive and negative infinity
+		/// \retval FP_NAN for NaNs
+		/// \retval FP_NORMAL for all other (normal) values
+//		template<typename T> typename enable<int,T>::type fpclassify(T arg) { return functions::fpclassify(arg); }
+		inline int fpclassify(half arg) { return functions::fpclassify(arg); }
+		inline int fpclassify(expr arg) { return functions::fpclassify(arg); }
 
-		/// Remainder of division.
-		/// \param x first operand
-		/// \param y second operand
-		/// \return remainder of floating point division.
-//		template<typename T,typename U> typename enable<expr,T,U>::type fmod(T x, U y) { return functions::fmod(x, y); }
-		inline expr fmod(half x, half y) { return functions::fmod(x, y); }
-		inline expr fmod(half x, expr y) { return functions::fmod(x, y); }
-		inline expr fmod(expr x, half y) { return functions::fmod(x, y); }
-		inline expr fmod(expr x, expr y) { return functions::fmod(x, y); }
+		/// Check if finite number.
+		/// \param arg number to check
+		/// \retval true if neither infinity nor NaN
+		/// \retval false else
+//		template<typename T> typename enable<bool,T>::type isfinite(T arg) { return functions::isfinite(arg); }
+		inline bool isfinite(half arg) { return functions::isfinite(arg); }
+		inline bool isfinite(expr arg) { return functions::isfinite(arg); }
 
-		/// Remainder of division.
+		/// Check for infinity.
+		/// \param arg number to check
+		/// \retval true for positive or negative infinity
+		/// \retval false else
+//		template<typename T> typename enable<bool,T>::type isinf(T arg) { return functions::isinf(arg); }
+		inline bool isinf(half arg) { return functions::isinf(arg); }
+		inline bool isinf(expr arg) { return functions::isinf(arg); }
+
+		/// Check for NaN.
+		/// \param arg number to check
+		/// \retval true for NaNs
+		/// \retval false else
+//		template<typename T> typename enable<bool,T>::type isnan(T arg) { return functions::isnan(arg); }
+		inline bool isnan(half arg) { return functions::isnan(arg); }
+		inline bool isnan(expr arg) { return functions::isnan(arg); }
+
+		/// Check if normal number.
+		/// \param arg number to check
+		/// \retval true if normal number
+		/// \retval false if either subnormal, zero, infinity or NaN
+//		template<typename T> typename enable<bool,T>::type isnormal(T arg) { return functions::isnormal(arg); }
+		inline bool isnormal(half arg) { return functions::isnormal(arg); }
+		inline bool isnormal(expr arg) { return functions::isnormal(arg); }
+
+		/// Check sign.
+		/// \param arg number to check
+		/// \retval true for negative number
+		/// \retval false for positive number
+//		template<typename T> typename enable<bool,T>::type signbit(T arg) { return functions::signbit(arg); }
+		inline bool signbit(half arg) { return functions::signbit(arg); }
+		inline bool signbit(expr arg) { return functions::signbit(arg); }
+
+		/// \}
+		/// \name Comparison
+		/// \{
+
+		/// Comparison for greater than.
 		/// \param x first operand
 		/// \param y second operand
-		/// \return remainder of floating point division.
-//		template<typename T,typename U> typename enable<expr,T,U>::type remainder(T x, U y) { return functions::remainder(x, y); }
-		inline expr remainder(half x, half y) { return functions::remainder(x, y); }
-		inline expr remainder(half x, expr y) { return functions::remainder(x, y); }
-		inline expr remainder(expr x, half y) { return functions::remainder(x, y); }
-		inline expr remainder(expr x, expr y) { return functions::remainder(x, y); }
+		/// \retval true if \a x greater than \a y
+		/// \retval false else
+//		template<typename T,typename U> typename enable<bool,T,U>::type isgreater(T x, U y) { return functions::isgreater(x, y); }
+		inline bool isgreater(half x, half y) { return functions::isgreater(x, y); }
+		inline bool isgreater(half x, expr y) { return functions::isgreater(x, y); }
+		inline bool isgreater(expr x, half y) { return functions::isgreater(x, y); }
+		inline bool isgreater(expr x, expr y) { return functions::isgreater(x, y); }
 
-		/// Remainder of division.
+		/// Comparison for greater equal.
 		/// \param x first operand
 		/// \param y second operand
-		/// \param quo address to store some bits of quotient at
-		/// \return remainder of floating point division.
-//		template<typename T,typename U> typename enable<expr,T,U>::type remquo(T x, U y, int *quo) { return functions::remquo(x, y, quo); }
-		inline expr remquo(half x, half y, int *quo) { return functions::remquo(x, y, quo); }
-		inline expr remquo(half x, expr y, int *quo) { return functions::remquo(x, y, quo); }
-		inline expr remquo(expr x, half y, int *quo) { return functions::remquo(x, y, quo); }
-		inline expr remquo(expr x, expr y, int *quo) { return functions::remquo(x, y, quo); }
+		/// \retval true if \a x greater equal \a y
+		/// \retval false else
+//		template<typename T,typename U> typename enable<bool,T,U>::type isgreaterequal(T x, U y) { return functions::isgreaterequal(x, y); }
+		inline bool isgreaterequal(half x, half y) { return functions::isgreaterequal(x, y); }
+		inline bool isgreaterequal(half x, expr y) { return functions::isgreaterequal(x, y); }
+		inline bool isgreaterequal(expr x, half y) { return functions::isgreaterequal(x, y); }
+		inline bool isgreaterequal(expr x, expr y) { return functions::isgreaterequal(x, y); }
 
-		/// Fused multiply add.
+		/// Comparison for less than.
 		/// \param x first operand
 		/// \param y second operand
-		/// \param z third operand
-		/// \return ( \a x * \a y ) + \a z rounded as one operation.
-//		template<typename T,typename U,typename V> typename enable<expr,T,U,V>::type fma(T x, U y, V z) { return functions::fma(x, y, z); }
-		inline expr fma(half x, half y, half z) { return functions::fma(x, y, z); }
-		inline expr fma(half x, half y, expr z) { return functions::fma(x, y, z); }
-		inline expr fma(half x, expr y, half z) { return functions::fma(x, y, z); }
-		inline expr fma(half x, expr y, expr z) { return functions::fma(x, y, z); }
-		inline expr fma(expr x, half y, half z) { return functions::fma(x, y, z); }
-		inline expr fma(expr x, half y, expr z) { return functions::fma(x, y, z); }
-		inline expr fma(expr x, expr y, half z) { return functions::fma(x, y, z); }
-		inline expr fma(expr x, expr y, expr z) { return functions::fma(x, y, z); }
+		/// \retval true if \a x less than \a y
+		/// \retval false else
+//		template<typename T,typename U> typename enable<bool,T,U>::type isless(T x, U y) { return functions::isless(x, y); }
+		inline bool isless(half x, half y) { return functions::isless(x, y); }
+		inline bool isless(half x, expr y) { return functions::isless(x, y); }
+		inline bool isless(expr x, half y) { return functions::isless(x, y); }
+		inline bool isless(expr x, expr y) { return functions::isless(x, y); }
 
-		/// Maximum of half expressions.
+		/// Comparison for less equal.
 		/// \param x first operand
 		/// \param y second operand
-		/// \return maximum of operands
-//		template<typename T,typename U> typename result<T,U>::type fmax(T x, U y) { return binary_specialized<T,U>::fmax(x, y); }
-		inline half fmax(half x, half y) { return binary_specialized<half,half>::fmax(x, y); }
-		inline expr fmax(half x, expr y) { return binary_specialized<half,expr>::fmax(x, y); }
-		inline expr fmax(expr x, half y) { return binary_specialized<expr,half>::fmax(x, y); }
-		inline expr fmax(expr x, expr y) { return binary_specialized<expr,expr>::fmax(x, y); }
+		/// \retval true if \a x less equal \a y
+		/// \retval false else
+//		template<typename T,typename U> typename enable<bool,T,U>::type islessequal(T x, U y) { return functions::islessequal(x, y); }
+		inline bool islessequal(half x, half y) { return functions::islessequal(x, y); }
+		inline bool islessequal(half x, expr y) { return functions::islessequal(x, y); }
+		inline bool islessequal(expr x, half y) { return functions::islessequal(x, y); }
+		inline bool islessequal(expr x, expr y) { return functions::islessequal(x, y); }
 
-		/// Minimum of half expressions.
+		/// Comarison for less or greater.
 		/// \param x first operand
 		/// \param y second operand
-		/// \return minimum of operands
-//		template<typename T,typename U> typename result<T,U>::type fmin(T x, U y) { return binary_specialized<T,U>::fmin(x, y); }
-		inline half fmin(half x, half y) { return binary_specialized<half,half>::fmin(x, y); }
-		inline expr fmin(half x, expr y) { return binary_specialized<half,expr>::fmin(x, y); }
-		inline expr fmin(expr x, half y) { return binary_specialized<expr,half>::fmin(x, y); }
-		inline expr fmin(expr x, expr y) { return binary_specialized<expr,expr>::fmin(x, y); }
+		/// \retval true if either less or greater
+		/// \retval false else
+//		template<typename T,typename U> typename enable<bool,T,U>::type islessgreater(T x, U y) { return functions::islessgreater(x, y); }
+		inline bool islessgreater(half x, half y) { return functions::islessgreater(x, y); }
+		inline bool islessgreater(half x, expr y) { return functions::islessgreater(x, y); }
+		inline bool islessgreater(expr x, half y) { return functions::islessgreater(x, y); }
+		inline bool islessgreater(expr x, expr y) { return functions::islessgreater(x, y); }
 
-		/// Positive difference.
+		/// Check if unordered.
 		/// \param x first operand
 		/// \param y second operand
-		/// \return \a x - \a y or 0 if difference negative
-//		template<typename T,typename U> typename enable<expr,T,U>::type fdim(T x, U y) { return functions::fdim(x, y); }
-		inline expr fdim(half x, half y) { return functions::fdim(x, y); }
-		inline expr fdim(half x, expr y) { return functions::fdim(x, y); }
-		inline expr fdim(expr x, half y) { return functions::fdim(x, y); }
-		inline expr fdim(expr x, expr y) { return functions::fdim(x, y); }
-
-		/// Get NaN value.
-		/// \return quiet NaN
-		inline half nanh(const char*) { return functions::nanh(); }
+		/// \retval true if unordered (one or two NaN operands)
+		/// \retval false else
+//		template<typename T,typename U> typename enable<bool,T,U>::type isunordered(T x, U y) { return functions::isunordered(x, y); }
+		inline bool isunordered(half x, half y) { return functions::isunordered(x, y); }
+		inline bool isunordered(half x, expr y) { return functions::isunordered(x, y); }
+		inline bool isunordered(expr x, half y) { return functions::isunordered(x, y); }
+		inline bool isunordered(expr x, expr y) { return functions::isunordered(x, y); }
 
-		/// \}
-		/// \name Exponential functions
+		/// \name Casting
 		/// \{
 
-		/// Exponential function.
-		/// \param arg function argument
-		/// \return e raised to \a arg
-//		template<typename T> typename enable<expr,T>::type exp(T arg) { return functions::exp(arg); }
-		inline expr exp(half arg) { return functions::exp(arg); }
-		inline expr exp(expr arg) { return functions::exp(arg); }
-
-		/// Exponential minus one.
-		/// \param arg function argument
-		/// \return e raised to \a arg subtracted by 1
-//		template<typename T> typename enable<expr,T>::type expm1(T arg) { return functions::expm1(arg); }
-		inline expr expm1(half arg) { return functions::expm1(arg); }
-		inline expr expm1(expr arg) { return functions::expm1(arg); }
-
-		/// Binary exponential.
-		/// \param arg function argument
-		/// \return 2 raised to \a arg
-//		template<typename T> typename enable<expr,T>::type exp2(T arg) { return functions::exp2(arg); }
-		inline expr exp2(half arg) { return functions::exp2(arg); }
-		inline expr exp2(expr arg) { return functions::exp2(arg); }
-
-		/// Natural logorithm.
-		/// \param arg function argument
-		/// \return logarithm of \a arg to base e
-//		template<typename T> typename enable<expr,T>::type log(T arg) { return functions::log(arg); }
-		inline expr log(half arg) { return functions::log(arg); }
-		inline expr log(expr arg) { return functions::log(arg); }
-
-		/// Common logorithm.
-		/// \param arg function argument
-		/// \return logarithm of \a arg to base 10
-//		template<typename T> typename enable<expr,T>::type log10(T arg) { return functions::log10(arg); }
-		inline expr log10(half arg) { return functions::log10(arg); }
-		inline expr log10(expr arg) { return functions::log10(arg); }
+		/// Cast to or from half-precision floating point number.
+		/// This casts between [half](\ref half_float::half) and any built-in arithmetic type. The values are converted 
+		/// directly using the given rounding mode, without any roundtrip over `float` that a `static_cast` would otherwise do. 
+		/// It uses the default rounding mode.
+		///
+		/// Using this cast with neither of the two types being a [half](\ref half_float::half) or with any of the two types 
+		/// not being a built-in arithmetic type (apart from [half](\ref half_float::half), of course) results in a compiler 
+		/// error and casting between [half](\ref half_float::half)s is just a no-op.
+		/// \tparam T destination type (half or built-in arithmetic type)
+		/// \tparam U source type (half or built-in arithmetic type)
+		/// \param arg value to cast
+		/// \return \a arg converted to destination type
+		template<typename T,typename U> T half_cast(U arg) { return half_caster<T,U>::cast(arg); }
 
-		/// Natural logorithm.
-		/// \param arg function argument
-		/// \return logarithm of \a arg plus 1 to base e
-//		template<typename T> typename enable<expr,T>::type log1p(T arg) { return functions::log1p(arg); }
-		inline expr log1p(half arg) { return functions::log1p(arg); }
-		inline expr log1p(expr arg) { return functions::log1p(arg); }
+		/// Cast to or from half-precision floating point number.
+		/// This casts between [half](\ref half_float::half) and any built-in arithmetic type. The values are converted 
+		/// directly using the given rounding mode, without any roundtrip over `float` that a `static_cast` would otherwise do.
+		///
+		/// Using this cast with neither of the two types being a [half](\ref half_float::half) or with any of the two types 
+		/// not being a built-in arithmetic type (apart from [half](\ref half_float::half), of course) results in a compiler 
+		/// error and casting between [half](\ref half_float::half)s is just a no-op.
+		/// \tparam T destination type (half or built-in arithmetic type)
+		/// \tparam R rounding mode to use.
+		/// \tparam U source type (half or built-in arithmetic type)
+		/// \param arg value to cast
+		/// \return \a arg converted to destination type
+		template<typename T,std::float_round_style R,typename U> T half_cast(U arg) { return half_caster<T,U,R>::cast(arg); }
 
-		/// Binary logorithm.
-		/// \param arg function argument
-		/// \return logarithm of \a arg to base 2
-//		template<typename T> typename enable<expr,T>::type log2(T arg) { return functions::log2(arg); }
-		inline expr log2(half arg) { return functions::log2(arg); }
-		inline expr log2(expr arg) { return functions::log2(arg); }
+		/// Cast to half-precision with saturation.
+		/// This converts any built-in arithmetic type to [half](\ref half_float::half) like half_cast(), but finite values too 
+		/// large for half-precision become the largest finite half of their sign (65504) instead of infinity, regardless of 
+		/// the rounding mode, just like the saturating convert() overloads. Infinities and NaNs stay as they are.
+		/// It uses the default rounding mode.
+		/// \tparam U source type (built-in arithmetic type)
+		/// \param arg value to cast
+		/// \return \a arg converted to half-precision
+		template<typename U> half saturate_cast(U arg) { return bulk::saturate_cast<(std::float_round_style)(HALF_ROUND_STYLE)>(arg); }
 
+		/// Cast to half-precision with saturation.
+		/// This converts any built-in arithmetic type to [half](\ref half_float::half) like half_cast(), but finite values too 
+		/// large for half-precision become the largest finite half of their sign (65504) instead of infinity, regardless of 
+		/// the rounding mode, just like the saturating convert() overloads. Infinities and NaNs stay as they are.
+		/// \tparam R rounding mode to use.
+		/// \tparam U source type (built-in arithmetic type)
+		/// \param arg value to cast
+		/// \return \a arg converted to half-precision
+		template<std::float_round_style R,typename U> half saturate_cast(U arg) { return bulk::saturate_cast<R>(arg); }
+
+		/// Cast to half-precision with stochastic rounding.
+		/// This rounds the magnitude of \a arg up with a probability equal to its distance from the next smaller 
+		/// half-precision magnitude relative to the distance between the two, and down otherwise, so that the expected 
+		/// result equals \a arg. Values between the largest finite half and 65536 round to infinity with a probability as if 
+		/// infinity was 65536, which is also where values start to overflow. The random number is taken from a 
+		/// counter-based generator, so the results are reproducible for the same seed and counter.
+		/// \param arg value to cast
+		/// \param rng random number generator, whose counter is advanced by one
+		/// \return \a arg rounded to half-precision
+		inline half stochastic_cast(float arg, stochastic_rng &rng) { return bulk::float2half_stochastic(arg, rng.seed, rng.counter++); }
 		/// \}
-		/// \name Power functions
+
+		/// \name Bulk conversion
 		/// \{
 
-		/// Square root.
-		/// \param arg function argument
-		/// \return square root of \a arg
-//		template<typename T> typename enable<expr,T>::type sqrt(T arg) { return functions::sqrt(arg); }
-		inline expr sqrt(half arg) { return functions::sqrt(arg); }
-		inline expr sqrt(expr arg) { return functions::sqrt(arg); }
+		/// Convert array of single-precision values to half-precision.
+		/// This converts each element exactly like half_cast() would, but processes many elements at once using F16C or SSE2 
+		/// instructions whenever available. The F16C instructions are used only if the executing processor supports them, 
+		/// which is checked once at the first conversion. It uses the default rounding mode.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		inline void convert(const float *src, half *dst, std::size_t n) { bulk::run(src, dst, n, &bulk::float2half<(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN,false>); }
+
+		/// Convert array of single-precision values to half-precision.
+		/// This converts each element exactly like half_cast() would, but processes many elements at once using F16C or SSE2 
+		/// instructions whenever available. The F16C instructions are used only if the executing processor supports them, 
+		/// which is checked once at the first conversion.
+		/// \tparam R rounding mode to use.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		template<std::float_round_style R> void convert(const float *src, half *dst, std::size_t n) { bulk::run(src, dst, n, &bulk::float2half<R,HALF_ROUND_TIES_TO_EVEN,false>); }
+
+		/// Convert array of single-precision values to half-precision.
+		/// This works like the version without tie-breaking rule, but resolves ties in round-to-nearest mode as requested 
+		/// regardless of `HALF_ROUND_TIES_TO_EVEN`. Rounding ties away from zero is not supported by the F16C instructions 
+		/// and thus uses an exact AVX2 or SSE2 emulation.
+		/// \tparam R rounding mode to use.
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		template<std::float_round_style R,bool E> void convert(const float *src, half *dst, std::size_t n) { bulk::run(src, dst, n, &bulk::float2half<R,E,false>); }
+
+		/// Convert array of single-precision values to half-precision with saturation.
+		/// This works like the version without saturation, but converts finite values too large for half-precision to the 
+		/// largest finite value of their sign instead of infinity, regardless of rounding mode. Infinities and NaNs are 
+		/// converted as usual. The clamping happens inside the conversion kernels, so it doesn't need an extra pass.
+		/// \tparam R rounding mode to use.
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \tparam S `true` for saturating overflows to the largest finite value, `false` for overflowing like half_cast()
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		template<std::float_round_style R,bool E,bool S> void convert(const float *src, half *dst, std::size_t n) { bulk::run(src, dst, n, &bulk::float2half<R,E,S>); }
+
+		/// Convert array of single-precision values to half-precision and collect statistics.
+		/// This converts each element exactly like the version without statistics, but additionally counts the values that 
+		/// overflowed to infinity, underflowed to zero, became subnormal or were NaN, and tracks the maximum relative error of 
+		/// all other nonzero values. These are computed in SIMD registers from the freshly converted blocks of values while 
+		/// still in the L1 cache, without a second pass over the source array. It uses the default rounding mode.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param stats statistics to add the results to
+		inline void convert(const float *src, half *dst, std::size_t n, conversion_stats &stats)
+		{
+			bulk::float2half_stats<(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(src, dst, n, stats);
+		}
 
-		/// Cubic root.
-		/// \param arg function argument
-		/// \return cubic root of \a arg
-//		template<typename T> typename enable<expr,T>::type cbrt(T arg) { return functions::cbrt(arg); }
-		inline expr cbrt(half arg) { return functions::cbrt(arg); }
-		inline expr cbrt(expr arg) { return functions::cbrt(arg); }
+		/// Convert array of single-precision values to half-precision and collect statistics.
+		/// This works like the version without rounding mode, but uses the given rounding mode.
+		/// \tparam R rounding mode to use.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param stats statistics to add the results to
+		template<std::float_round_style R> void convert(const float *src, half *dst, std::size_t n, conversion_stats &stats)
+		{
+			bulk::float2half_stats<R,HALF_ROUND_TIES_TO_EVEN>(src, dst, n, stats);
+		}
 
-		/// Hypotenuse function.
-		/// \param x first argument
-		/// \param y second argument
-		/// \return square root of sum of squares without internal over- or underflows
-//		template<typename T,typename U> typename enable<expr,T,U>::type hypot(T x, U y) { return functions::hypot(x, y); }
-		inline expr hypot(half x, half y) { return functions::hypot(x, y); }
-		inline expr hypot(half x, expr y) { return functions::hypot(x, y); }
-		inline expr hypot(expr x, half y) { return functions::hypot(x, y); }
-		inline expr hypot(expr x, expr y) { return functions::hypot(x, y); }
+		/// Convert array of single-precision values to half-precision and collect statistics.
+		/// This works like the version without tie-breaking rule, but resolves ties in round-to-nearest mode as requested 
+		/// regardless of `HALF_ROUND_TIES_TO_EVEN`.
+		/// \tparam R rounding mode to use.
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param stats statistics to add the results to
+		template<std::float_round_style R,bool E> void convert(const float *src, half *dst, std::size_t n, conversion_stats &stats)
+		{
+			bulk::float2half_stats<R,E>(src, dst, n, stats);
+		}
 
-		/// Power function.
-		/// \param base first argument
-		/// \param exp second argument
-		/// \return \a base raised to \a exp
-//		template<typename T,typename U> typename enable<expr,T,U>::type pow(T base, U exp) { return functions::pow(base, exp); }
-		inline expr pow(half base, half exp) { return functions::pow(base, exp); }
-		inline expr pow(half base, expr exp) { return functions::pow(base, exp); }
-		inline expr pow(expr base, half exp) { return functions::pow(base, exp); }
-		inline expr pow(expr base, expr exp) { return functions::pow(base, exp); }
+		/// Convert array of single-precision values to half-precision with stochastic rounding.
+		/// Each magnitude is rounded up with a probability equal to its distance from the next smaller half-precision 
+		/// magnitude relative to the distance between the two, and down otherwise, which makes the rounding unbiased on 
+		/// average. The random numbers are computed alongside the conversion in SIMD registers. This gives exactly the same 
+		/// results as calling stochastic_cast() on each element in order.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param rng random number generator, whose counter is advanced by \a n
+		inline void convert(const float *src, half *dst, std::size_t n, stochastic_rng &rng)
+		{
+			bulk::float2half_stochastic(src, dst, n, rng.seed, rng.counter);
+			rng.counter += n;
+		}
 
+		/// Convert array of half-precision values to single-precision.
+		/// This converts each element exactly like half_cast() would, but processes many elements at once using F16C or SSE2 
+		/// instructions whenever available, the latter without any table lookups.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		inline void convert(const half *src, float *dst, std::size_t n) { bulk::run(src, dst, n, &bulk::half2float); }
+
+		/// Convert array of half-precision values to single-precision.
+		/// This is equivalent to the version without rounding mode, since every half-precision value is exactly 
+		/// representable in single-precision. It is only provided for the sake of generic code.
+		/// \tparam R rounding mode to use.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		template<std::float_round_style R> void convert(const half *src, float *dst, std::size_t n) { bulk::run(src, dst, n, &bulk::half2float); }
+
+		/// Convert array of double-precision values to half-precision.
+		/// This converts each element exactly like half_cast() would, directly rounding each value to half-precision without 
+		/// an intermediate rounding to single-precision, but processes many elements at once using F16C or SSE2 instructions 
+		/// whenever available. It uses the default rounding mode.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		inline void convert(const double *src, half *dst, std::size_t n) { bulk::run(src, dst, n, &bulk::double2half<(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN,false>); }
+
+		/// Convert array of double-precision values to half-precision.
+		/// This converts each element exactly like half_cast() would, directly rounding each value to half-precision without 
+		/// an intermediate rounding to single-precision, but processes many elements at once using F16C or SSE2 instructions 
+		/// whenever available.
+		/// \tparam R rounding mode to use.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		template<std::float_round_style R> void convert(const double *src, half *dst, std::size_t n) { bulk::run(src, dst, n, &bulk::double2half<R,HALF_ROUND_TIES_TO_EVEN,false>); }
+
+		/// Convert array of double-precision values to half-precision.
+		/// This works like the version without tie-breaking rule, but resolves ties in round-to-nearest mode as requested 
+		/// regardless of `HALF_ROUND_TIES_TO_EVEN`.
+		/// \tparam R rounding mode to use.
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		template<std::float_round_style R,bool E> void convert(const double *src, half *dst, std::size_t n) { bulk::run(src, dst, n, &bulk::double2half<R,E,false>); }
+
+		/// Convert array of double-precision values to half-precision with saturation.
+		/// This works like the version without saturation, but converts finite values too large for half-precision to the 
+		/// largest finite value of their sign instead of infinity, regardless of rounding mode. Infinities and NaNs are 
+		/// converted as usual. The clamping happens inside the conversion kernels, so it doesn't need an extra pass.
+		/// \tparam R rounding mode to use.
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \tparam S `true` for saturating overflows to the largest finite value, `false` for overflowing like half_cast()
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		template<std::float_round_style R,bool E,bool S> void convert(const double *src, half *dst, std::size_t n) { bulk::run(src, dst, n, &bulk::double2half<R,E,S>); }
+
+		/// Convert array of half-precision values to double-precision.
+		/// This converts each element exactly like half_cast() would, but processes many elements at once using F16C or SSE2 
+		/// instructions whenever available.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		inline void convert(const half *src, double *dst, std::size_t n) { bulk::run(src, dst, n, &bulk::half2double); }
+
+		/// Convert array of half-precision values to double-precision.
+		/// This is equivalent to the version without rounding mode, since every half-precision value is exactly 
+		/// representable in double-precision. It is only provided for the sake of generic code.
+		/// \tparam R rounding mode to use.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		template<std::float_round_style R> void convert(const half *src, double *dst, std::size_t n) { bulk::run(src, dst, n, &bulk::half2double); }
+
+		/// Set threshold for streaming bulk conversions.
+		/// Bulk conversions writing at least this many bytes use non-temporal stores and software prefetching, which keeps 
+		/// very large arrays from evicting other data from the caches. It can be changed at any time, with conversions that 
+		/// are already running not necessarily noticing the change. Use 0 for always streaming and 
+		/// `std::numeric_limits<std::size_t>::max()` for never streaming.
+		/// \param bytes minimum size of destination arrays in bytes, `HALF_STREAMING_THRESHOLD` by default
+		inline void set_streaming_threshold(std::size_t bytes) { bulk::streaming_threshold() = bytes; }
 		/// \}
-		/// \name Trigonometric functions
+
+		/// \name Parallel bulk conversion
 		/// \{
 
-		/// Sine function.
-		/// \param arg function argument
-		/// \return sine value of \a arg
-//		template<typename T> typename enable<expr,T>::type sin(T arg) { return functions::sin(arg); }
-		inline expr sin(half arg) { return functions::sin(arg); }
-		inline expr sin(expr arg) { return functions::sin(arg); }
+		/// Set number of threads for parallel bulk conversions.
+		/// This recreates the thread pool used by convert_parallel(), which otherwise starts as many threads as the hardware 
+		/// supports at the first parallel conversion. It may be called while parallel conversions are running on other 
+		/// threads, which then finish on the old pool. Without C++11 thread support this does nothing and all parallel 
+		/// conversions run on the calling thread.
+		/// \param threads number of threads including the calling thread, 0 for the hardware concurrency
+		inline void set_parallel_threads(unsigned int threads)
+		{
+		#if HALF_ENABLE_CPP11_THREAD
+			parallel_pool(threads ? threads : std::max(std::thread::hardware_concurrency(), 1u));
+		#else
+			static_cast<void>(threads);
+		#endif
+		}
 
-		/// Cosine function.
-		/// \param arg function argument
-		/// \return cosine value of \a arg
-//		template<typename T> typename enable<expr,T>::type cos(T arg) { return functions::cos(arg); }
-		inline expr cos(half arg) { return functions::cos(arg); }
-		inline expr cos(expr arg) { return functions::cos(arg); }
+		/// Convert array of single-precision values to half-precision in parallel.
+		/// This works like convert(), but splits the array into cache-sized chunks that are converted by a pool of threads, 
+		/// which pays off only for arrays much larger than the cache. It uses the default rounding mode.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param first_touch `true` to let each thread convert one contiguous part of the array, so that the pages of a 
+		/// freshly allocated destination are placed on the NUMA node of the thread writing them, `false` to balance the 
+		/// load dynamically
+		inline void convert_parallel(const float *src, half *dst, std::size_t n, bool first_touch = false)
+		{
+			parallel_for(n, first_touch, convert_chunk<float,half>(src, dst, n, 
+				&bulk::float2half<(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN,false>));
+		}
 
-		/// Tangent function.
-		/// \param arg function argument
-		/// \return tangent value of \a arg
-//		template<typename T> typename enable<expr,T>::type tan(T arg) { return functions::tan(arg); }
-		inline expr tan(half arg) { return functions::tan(arg); }
-		inline expr tan(expr arg) { return functions::tan(arg); }
+		/// Convert array of single-precision values to half-precision in parallel.
+		/// This works like convert(), but splits the array into cache-sized chunks that are converted by a pool of threads, 
+		/// which pays off only for arrays much larger than the cache.
+		/// \tparam R rounding mode to use.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param first_touch `true` for NUMA-local first-touch of the destination, `false` for dynamic load balancing
+		template<std::float_round_style R> void convert_parallel(const float *src, half *dst, std::size_t n, bool first_touch = false)
+		{
+			parallel_for(n, first_touch, convert_chunk<float,half>(src, dst, n, &bulk::float2half<R,HALF_ROUND_TIES_TO_EVEN,false>));
+		}
 
-		/// Arc sine.
-		/// \param arg function argument
-		/// \return arc sine value of \a arg
-//		template<typename T> typename enable<expr,T>::type asin(T arg) { return functions::asin(arg); }
-		inline expr asin(half arg) { return functions::asin(arg); }
-		inline expr asin(expr arg) { return functions::asin(arg); }
+		/// Convert array of single-precision values to half-precision in parallel with stochastic rounding.
+		/// This works like convert() with stochastic rounding, but splits the array into cache-sized chunks that are converted 
+		/// by a pool of threads. Since each value uses the random number for its own counter, the results are exactly the 
+		/// same for any number of threads.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param rng random number generator, whose counter is advanced by \a n
+		/// \param first_touch `true` for NUMA-local first-touch of the destination, `false` for dynamic load balancing
+		inline void convert_parallel(const float *src, half *dst, std::size_t n, stochastic_rng &rng, bool first_touch = false)
+		{
+			parallel_for(n, first_touch, stochastic_chunk(src, dst, rng.seed, rng.counter));
+			rng.counter += n;
+		}
 
-		/// Arc cosine function.
-		/// \param arg function argument
-		/// \return arc cosine value of \a arg
-//		template<typename T> typename enable<expr,T>::type acos(T arg) { return functions::acos(arg); }
-		inline expr acos(half arg) { return functions::acos(arg); }
-		inline expr acos(expr arg) { return functions::acos(arg); }
+		/// Convert array of half-precision values to single-precision in parallel.
+		/// This works like convert(), but splits the array into cache-sized chunks that are converted by a pool of threads, 
+		/// which pays off only for arrays much larger than the cache.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param first_touch `true` for NUMA-local first-touch of the destination, `false` for dynamic load balancing
+		inline void convert_parallel(const half *src, float *dst, std::size_t n, bool first_touch = false)
+		{
+			parallel_for(n, first_touch, convert_chunk<half,float>(src, dst, n, &bulk::half2float));
+		}
 
-		/// Arc tangent function.
-		/// \param arg function argument
-		/// \return arc tangent value of \a arg
-//		template<typename T> typename enable<expr,T>::type atan(T arg) { return functions::atan(arg); }
-		inline expr atan(half arg) { return functions::atan(arg); }
-		inline expr atan(expr arg) { return functions::atan(arg); }
+		/// Convert array of double-precision values to half-precision in parallel.
+		/// This works like convert(), but splits the array into cache-sized chunks that are converted by a pool of threads, 
+		/// which pays off only for arrays much larger than the cache. It uses the default rounding mode.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param first_touch `true` for NUMA-local first-touch of the destination, `false` for dynamic load balancing
+		inline void convert_parallel(const double *src, half *dst, std::size_t n, bool first_touch = false)
+		{
+			parallel_for(n, first_touch, convert_chunk<double,half>(src, dst, n, 
+				&bulk::double2half<(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN,false>));
+		}
 
-		/// Arc tangent function.
-		/// \param x first argument
-		/// \param y second argument
-		/// \return arc tangent value
-//		template<typename T,typename U> typename enable<expr,T,U>::type atan2(T x, U y) { return functions::atan2(x, y); }
-		inline expr atan2(half x, half y) { return functions::atan2(x, y); }
-		inline expr atan2(half x, expr y) { return functions::atan2(x, y); }
-		inline expr atan2(expr x, half y) { return functions::atan2(x, y); }
-		inline expr atan2(expr x, expr y) { return functions::atan2(x, y); }
+		/// Convert array of double-precision values to half-precision in parallel.
+		/// This works like convert(), but splits the array into cache-sized chunks that are converted by a pool of threads, 
+		/// which pays off only for arrays much larger than the cache.
+		/// \tparam R rounding mode to use.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param first_touch `true` for NUMA-local first-touch of the destination, `false` for dynamic load balancing
+		template<std::float_round_style R> void convert_parallel(const double *src, half *dst, std::size_t n, bool first_touch = false)
+		{
+			parallel_for(n, first_touch, convert_chunk<double,half>(src, dst, n, &bulk::double2half<R,HALF_ROUND_TIES_TO_EVEN,false>));
+		}
 
+		/// Convert array of half-precision values to double-precision in parallel.
+		/// This works like convert(), but splits the array into cache-sized chunks that are converted by a pool of threads, 
+		/// which pays off only for arrays much larger than the cache.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param first_touch `true` for NUMA-local first-touch of the destination, `false` for dynamic load balancing
+		inline void convert_parallel(const half *src, double *dst, std::size_t n, bool first_touch = false)
+		{
+			parallel_for(n, first_touch, convert_chunk<half,double>(src, dst, n, &bulk::half2double));
+		}
 		/// \}
-		/// \name Hyperbolic functions
+
+		/// \name Strided and indexed bulk conversion
 		/// \{
 
-		/// Hyperbolic sine.
-		/// \param arg function argument
-		/// \return hyperbolic sine value of \a arg
-//		template<typename T> typename enable<expr,T>::type sinh(T arg) { return functions::sinh(arg); }
-		inline expr sinh(half arg) { return functions::sinh(arg); }
-		inline expr sinh(expr arg) { return functions::sinh(arg); }
+		/// Convert strided array of single-precision values to half-precision.
+		/// This converts each element exactly like half_cast() would, but gathers blocks of elements into the cache and 
+		/// converts them at once like convert(), which is useful for single members of an array of structures or columns of 
+		/// a row-major matrix. It uses the default rounding mode.
+		/// \param src first value to convert
+		/// \param src_stride distance between consecutive source values in floats, may be negative
+		/// \param dst first element to store converted values into
+		/// \param dst_stride distance between consecutive destination elements in halfs, may be negative
+		/// \param n number of values to convert
+		inline void convert_strided(const float *src, std::ptrdiff_t src_stride, half *dst, std::ptrdiff_t dst_stride, std::size_t n)
+		{
+			convert_staged(strided_array<const float>(src, src_stride), strided_array<half>(dst, dst_stride), n, 
+				&bulk::float2half<(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN,false>);
+		}
 
-		/// Hyperbolic cosine.
-		/// \param arg function argument
-		/// \return hyperbolic cosine value of \a arg
-//		template<typename T> typename enable<expr,T>::type cosh(T arg) { return functions::cosh(arg); }
-		inline expr cosh(half arg) { return functions::cosh(arg); }
-		inline expr cosh(expr arg) { return functions::cosh(arg); }
+		/// Convert strided array of single-precision values to half-precision.
+		/// This converts each element exactly like half_cast() would, but gathers blocks of elements into the cache and 
+		/// converts them at once like convert().
+		/// \tparam R rounding mode to use.
+		/// \param src first value to convert
+		/// \param src_stride distance between consecutive source values in floats, may be negative
+		/// \param dst first element to store converted values into
+		/// \param dst_stride distance between consecutive destination elements in halfs, may be negative
+		/// \param n number of values to convert
+		template<std::float_round_style R> void convert_strided(const float *src, std::ptrdiff_t src_stride, half *dst, std::ptrdiff_t dst_stride, std::size_t n)
+		{
+			convert_staged(strided_array<const float>(src, src_stride), strided_array<half>(dst, dst_stride), n, &bulk::float2half<R,HALF_ROUND_TIES_TO_EVEN,false>);
+		}
 
-		/// Hyperbolic tangent.
-		/// \param arg function argument
-		/// \return hyperbolic tangent value of \a arg
-//		template<typename T> typename enable<expr,T>::type tanh(T arg) { return functions::tanh(arg); }
-		inline expr tanh(half arg) { return functions::tanh(arg); }
-		inline expr tanh(expr arg) { return functions::tanh(arg); }
+		/// Convert strided array of half-precision values to single-precision.
+		/// This converts each element exactly like half_cast() would, but gathers blocks of elements into the cache and 
+		/// converts them at once like convert().
+		/// \param src first value to convert
+		/// \param src_stride distance between consecutive source values in halfs, may be negative
+		/// \param dst first element to store converted values into
+		/// \param dst_stride distance between consecutive destination elements in floats, may be negative
+		/// \param n number of values to convert
+		inline void convert_strided(const half *src, std::ptrdiff_t src_stride, float *dst, std::ptrdiff_t dst_stride, std::size_t n)
+		{
+			convert_staged(strided_array<const half>(src, src_stride), strided_array<float>(dst, dst_stride), n, &bulk::half2float);
+		}
+
+		/// Convert indexed single-precision values to half-precision.
+		/// This stores the value at `src[index[i]]` converted to half-precision into `dst[i]` for each `i` in `[0,n)`, but 
+		/// gathers blocks of values into the cache and converts them at once like convert(). It uses the default rounding mode.
+		/// \param src array of values to convert
+		/// \param index indices of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		inline void convert_gather(const float *src, const std::size_t *index, half *dst, std::size_t n)
+		{
+			convert_staged(indexed_array<const float>(src, index), strided_array<half>(dst, 1), n, 
+				&bulk::float2half<(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN,false>);
+		}
+
+		/// Convert indexed single-precision values to half-precision.
+		/// This stores the value at `src[index[i]]` converted to half-precision into `dst[i]` for each `i` in `[0,n)`, but 
+		/// gathers blocks of values into the cache and converts them at once like convert().
+		/// \tparam R rounding mode to use.
+		/// \param src array of values to convert
+		/// \param index indices of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		template<std::float_round_style R> void convert_gather(const float *src, const std::size_t *index, half *dst, std::size_t n)
+		{
+			convert_staged(indexed_array<const float>(src, index), strided_array<half>(dst, 1), n, &bulk::float2half<R,HALF_ROUND_TIES_TO_EVEN,false>);
+		}
 
-		/// Hyperbolic area sine.
-		/// \param arg function argument
-		/// \return area sine value of \a arg
-//		template<typename T> typename enable<expr,T>::type asinh(T arg) { return functions::asinh(arg); }
-		inline expr asinh(half arg) { return functions::asinh(arg); }
-		inline expr asinh(expr arg) { return functions::asinh(arg); }
+		/// Convert indexed half-precision values to single-precision.
+		/// This stores the value at `src[index[i]]` converted to single-precision into `dst[i]` for each `i` in `[0,n)`, but 
+		/// gathers blocks of values into the cache and converts them at once like convert().
+		/// \param src array of values to convert
+		/// \param index indices of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		inline void convert_gather(const half *src, const std::size_t *index, float *dst, std::size_t n)
+		{
+			convert_staged(indexed_array<const half>(src, index), strided_array<float>(dst, 1), n, &bulk::half2float);
+		}
 
-		/// Hyperbolic area cosine.
-		/// \param arg function argument
-		/// \return area cosine value of \a arg
-//		template<typename T> typename enable<expr,T>::type acosh(T arg) { return functions::acosh(arg); }
-		inline expr acosh(half arg) { return functions::acosh(arg); }
-		inline expr acosh(expr arg) { return functions::acosh(arg); }
+		/// Convert single-precision values to indexed half-precision elements.
+		/// This stores the value at `src[i]` converted to half-precision into `dst[index[i]]` for each `i` in `[0,n)`, but 
+		/// converts blocks of values at once like convert() before scattering them. It uses the default rounding mode.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param index indices of elements to store converted values into
+		/// \param n number of values to convert
+		inline void convert_scatter(const float *src, half *dst, const std::size_t *index, std::size_t n)
+		{
+			convert_staged(strided_array<const float>(src, 1), indexed_array<half>(dst, index), n, 
+				&bulk::float2half<(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN,false>);
+		}
 
-		/// Hyperbolic area tangent.
-		/// \param arg function argument
-		/// \return area tangent value of \a arg
-//		template<typename T> typename enable<expr,T>::type atanh(T arg) { return functions::atanh(arg); }
-		inline expr atanh(half arg) { return functions::atanh(arg); }
-		inline expr atanh(expr arg) { return functions::atanh(arg); }
+		/// Convert single-precision values to indexed half-precision elements.
+		/// This stores the value at `src[i]` converted to half-precision into `dst[index[i]]` for each `i` in `[0,n)`, but 
+		/// converts blocks of values at once like convert() before scattering them.
+		/// \tparam R rounding mode to use.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param index indices of elements to store converted values into
+		/// \param n number of values to convert
+		template<std::float_round_style R> void convert_scatter(const float *src, half *dst, const std::size_t *index, std::size_t n)
+		{
+			convert_staged(strided_array<const float>(src, 1), indexed_array<half>(dst, index), n, &bulk::float2half<R,HALF_ROUND_TIES_TO_EVEN,false>);
+		}
 
+		/// Convert half-precision values to indexed single-precision elements.
+		/// This stores the value at `src[i]` converted to single-precision into `dst[index[i]]` for each `i` in `[0,n)`, but 
+		/// converts blocks of values at once like convert() before scattering them.
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param index indices of elements to store converted values into
+		/// \param n number of values to convert
+		inline void convert_scatter(const half *src, float *dst, const std::size_t *index, std::size_t n)
+		{
+			convert_staged(strided_array<const half>(src, 1), indexed_array<float>(dst, index), n, &bulk::half2float);
+		}
 		/// \}
-		/// \name Error and gamma functions
+
+		/// \name Interleaved bulk conversion
 		/// \{
 
-		/// Error function.
-		/// \param arg function argument
-		/// \return error function value of \a arg
-//		template<typename T> typename enable<expr,T>::type erf(T arg) { return functions::erf(arg); }
-		inline expr erf(half arg) { return functions::erf(arg); }
-		inline expr erf(expr arg) { return functions::erf(arg); }
+		/// Convert interleaved single-precision channels to planar half-precision arrays.
+		/// This stores the value at `src[i*channels+c]` converted to half-precision into `dst[c][i]` for each channel `c` 
+		/// and each `i` in `[0,n)`. It converts each element exactly like half_cast() would, but converts and deinterleaves 
+		/// blocks of values at once in a single pass over memory, with dedicated SIMD shuffles for 4 channels. It uses the 
+		/// default rounding mode.
+		/// \param src interleaved array of values to convert
+		/// \param dst arrays to store converted values of each channel into
+		/// \param channels number of channels
+		/// \param n number of values per channel
+		inline void convert_deinterleave(const float *src, half *const *dst, std::size_t channels, std::size_t n)
+		{
+			convert_deinterleaved(src, dst, channels, n, &bulk::float2half<(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN,false>);
+		}
 
-		/// Complementary error function.
-		/// \param arg function argument
-		/// \return 1 minus error function value of \a arg
-//		template<typename T> typename enable<expr,T>::type erfc(T arg) { return functions::erfc(arg); }
-		inline expr erfc(half arg) { return functions::erfc(arg); }
-		inline expr erfc(expr arg) { return functions::erfc(arg); }
+		/// Convert interleaved single-precision channels to planar half-precision arrays.
+		/// This stores the value at `src[i*channels+c]` converted to half-precision into `dst[c][i]` for each channel `c` 
+		/// and each `i` in `[0,n)`. It converts each element exactly like half_cast() would, but converts and deinterleaves 
+		/// blocks of values at once in a single pass over memory, with dedicated SIMD shuffles for 4 channels.
+		/// \tparam R rounding mode to use.
+		/// \param src interleaved array of values to convert
+		/// \param dst arrays to store converted values of each channel into
+		/// \param channels number of channels
+		/// \param n number of values per channel
+		template<std::float_round_style R> void convert_deinterleave(const float *src, half *const *dst, std::size_t channels, std::size_t n)
+		{
+			convert_deinterleaved(src, dst, channels, n, &bulk::float2half<R,HALF_ROUND_TIES_TO_EVEN,false>);
+		}
 
-		/// Natural logarithm of gamma function.
-		/// \param arg function argument
-		/// \return natural logarith of gamma function for \a arg
-//		template<typename T> typename enable<expr,T>::type lgamma(T arg) { return functions::lgamma(arg); }
-		inline expr lgamma(half arg) { return functions::lgamma(arg); }
-		inline expr lgamma(expr arg) { return functions::lgamma(arg); }
+		/// Convert planar half-precision arrays to interleaved single-precision channels.
+		/// This stores the value at `src[c][i]` converted to single-precision into `dst[i*channels+c]` for each channel `c` 
+		/// and each `i` in `[0,n)`. It converts each element exactly like half_cast() would, but interleaves and converts 
+		/// blocks of values at once in a single pass over memory, with dedicated SIMD shuffles for 4 channels.
+		/// \param src arrays of values to convert for each channel
+		/// \param dst interleaved array to store converted values into
+		/// \param channels number of channels
+		/// \param n number of values per channel
+		inline void convert_interleave(const half *const *src, float *dst, std::size_t channels, std::size_t n)
+		{
+			convert_interleaved(src, dst, channels, n, &bulk::half2float);
+		}
+		/// \}
 
-		/// Gamma function.
-		/// \param arg function argument
-		/// \return gamma function value of \a arg
-//		template<typename T> typename enable<expr,T>::type tgamma(T arg) { return functions::tgamma(arg); }
-		inline expr tgamma(half arg) { return functions::tgamma(arg); }
-		inline expr tgamma(expr arg) { return functions::tgamma(arg); }
+		/// \name In-place bulk conversion
+		/// \{
+
+		/// Convert array of single-precision values to half-precision in place.
+		/// This converts each element exactly like half_cast() would and packs the results into the first half of the 
+		/// memory occupied by the array, so no separate destination array is needed. The conversion runs front to back 
+		/// through a small buffer in the cache using the same SIMD kernels as convert(). It uses the default rounding mode.
+		/// \param data array of values to convert
+		/// \param n number of values to convert
+		/// \return pointer to the converted values at the beginning of \a data
+		inline half* convert_inplace(float *data, std::size_t n)
+		{
+			return convert_narrowing(data, n, &bulk::float2half<(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN,false>);
+		}
+
+		/// Convert array of single-precision values to half-precision in place.
+		/// This converts each element exactly like half_cast() would and packs the results into the first half of the 
+		/// memory occupied by the array, so no separate destination array is needed.
+		/// \tparam R rounding mode to use.
+		/// \param data array of values to convert
+		/// \param n number of values to convert
+		/// \return pointer to the converted values at the beginning of \a data
+		template<std::float_round_style R> half* convert_inplace(float *data, std::size_t n)
+		{
+			return convert_narrowing(data, n, &bulk::float2half<R,HALF_ROUND_TIES_TO_EVEN,false>);
+		}
 
+		/// Convert array of half-precision values to single-precision in place.
+		/// This converts each element exactly like half_cast() would and expands the results over the memory starting at 
+		/// the array, which has to provide room for \a n floats. The conversion runs back to front through a small buffer 
+		/// in the cache using the same SIMD kernels as convert(), so that no value is overwritten before it is converted.
+		/// \param data array of values to convert, must be aligned for and have room for \a n floats
+		/// \param n number of values to convert
+		/// \return pointer to the converted values at the beginning of \a data
+		inline float* convert_inplace(half *data, std::size_t n) { return convert_widening(data, n, &bulk::half2float); }
 		/// \}
-		/// \name Rounding
+
+		/// \name Integer bulk conversion
 		/// \{
 
-		/// Nearest integer not less than half value.
-		/// \param arg half to round
-		/// \return nearest integer not less than \a arg
-//		template<typename T> typename enable<half,T>::type ceil(T arg) { return functions::ceil(arg); }
-		inline half ceil(half arg) { return functions::ceil(arg); }
-		inline half ceil(expr arg) { return functions::ceil(arg); }
+		/// Convert array of integers to half-precision.
+		/// This converts each element exactly like half_cast() would, overflowing to infinity depending on the rounding 
+		/// mode, but processes many elements at once using SIMD instructions. Supported integer types are `signed char`, 
+		/// `unsigned char`, `short`, `unsigned short` and `int`. It uses the default rounding mode.
+		/// \tparam T source type (builtin integer type)
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param scale factor to multiply values with in single-precision before rounding, e.g. `1.0f/32768.0f` for 
+		/// normalizing 16-bit audio samples, in which case each value is converted like `half_cast<half>(float(x)*scale)`
+		template<typename T> void convert_int(const T *src, half *dst, std::size_t n, float scale = 1.0f)
+		{
+			bulk::int2half<(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN,false>(src, dst, n, scale);
+		}
 
-		/// Nearest integer not greater than half value.
-		/// \param arg half to round
-		/// \return nearest integer not greater than \a arg
-//		template<typename T> typename enable<half,T>::type floor(T arg) { return functions::floor(arg); }
-		inline half floor(half arg) { return functions::floor(arg); }
-		inline half floor(expr arg) { return functions::floor(arg); }
+		/// Convert array of integers to half-precision.
+		/// This converts each element exactly like half_cast() would, overflowing to infinity depending on the rounding 
+		/// mode, but processes many elements at once using SIMD instructions. Supported integer types are `signed char`, 
+		/// `unsigned char`, `short`, `unsigned short` and `int`.
+		/// \tparam R rounding mode to use.
+		/// \tparam T source type (builtin integer type)
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param scale factor to multiply values with in single-precision before rounding
+		template<std::float_round_style R,typename T> void convert_int(const T *src, half *dst, std::size_t n, float scale = 1.0f)
+		{
+			bulk::int2half<R,HALF_ROUND_TIES_TO_EVEN,false>(src, dst, n, scale);
+		}
 
-		/// Nearest integer not greater in magnitude than half value.
-		/// \param arg half to round
-		/// \return nearest integer not greater in magnitude than \a arg
-//		template<typename T> typename enable<half,T>::type trunc(T arg) { return functions::trunc(arg); }
-		inline half trunc(half arg) { return functions::trunc(arg); }
-		inline half trunc(expr arg) { return functions::trunc(arg); }
+		/// Convert array of integers to half-precision.
+		/// This works like the version without saturation policy, but can saturate overflows to the largest finite 
+		/// half-precision value instead, so that the results are always finite.
+		/// \tparam R rounding mode to use.
+		/// \tparam S `true` for saturating overflows to the largest finite value, `false` for overflowing like half_cast()
+		/// \tparam T source type (builtin integer type)
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param scale factor to multiply values with in single-precision before rounding
+		template<std::float_round_style R,bool S,typename T> void convert_int(const T *src, half *dst, std::size_t n, float scale = 1.0f)
+		{
+			bulk::int2half<R,HALF_ROUND_TIES_TO_EVEN,S>(src, dst, n, scale);
+		}
 
-		/// Nearest integer.
-		/// \param arg half to round
-		/// \return nearest integer, rounded away from zero in half-way cases
-//		template<typename T> typename enable<half,T>::type round(T arg) { return functions::round(arg); }
-		inline half round(half arg) { return functions::round(arg); }
-		inline half round(expr arg) { return functions::round(arg); }
+		/// Convert array of half-precision values to integers.
+		/// This converts each element exactly like half_cast() would, but processes many elements at once using SIMD 
+		/// instructions. Values outside the range of the integer type as well as infinities saturate to its limits and NaNs 
+		/// convert to the limit of their sign, just like half_cast() does for `int`. Supported integer types are 
+		/// `signed char`, `unsigned char`, `short`, `unsigned short` and `int`. It uses the default rounding mode.
+		/// \tparam T destination type (builtin integer type)
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param scale factor to multiply values with in single-precision before rounding, e.g. `32768.0f` for 16-bit 
+		/// audio samples, which has to be a power of two for the results to be exactly rounded
+		template<typename T> void convert_int(const half *src, T *dst, std::size_t n, float scale = 1.0f)
+		{
+			bulk::half2int<(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN,false>(src, dst, n, scale);
+		}
 
-		/// Nearest integer.
-		/// \param arg half to round
-		/// \return nearest integer, rounded away from zero in half-way cases
-//		template<typename T> typename enable<long,T>::type lround(T arg) { return functions::lround(arg); }
-		inline long lround(half arg) { return functions::lround(arg); }
-		inline long lround(expr arg) { return functions::lround(arg); }
+		/// Convert array of half-precision values to integers.
+		/// This converts each element exactly like half_cast() would, but processes many elements at once using SIMD 
+		/// instructions. Values outside the range of the integer type as well as infinities saturate to its limits and NaNs 
+		/// convert to the limit of their sign, just like half_cast() does for `int`. Supported integer types are 
+		/// `signed char`, `unsigned char`, `short`, `unsigned short` and `int`.
+		/// \tparam R rounding mode to use.
+		/// \tparam T destination type (builtin integer type)
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param scale factor to multiply values with in single-precision before rounding
+		template<std::float_round_style R,typename T> void convert_int(const half *src, T *dst, std::size_t n, float scale = 1.0f)
+		{
+			bulk::half2int<R,HALF_ROUND_TIES_TO_EVEN,false>(src, dst, n, scale);
+		}
 
-		/// Nearest integer using half's internal rounding mode.
-		/// \param arg half expression to round
-		/// \return nearest integer using default rounding mode
-//		template<typename T> typename enable<half,T>::type nearbyint(T arg) { return functions::nearbyint(arg); }
-		inline half nearbyint(half arg) { return functions::rint(arg); }
-		inline half nearbyint(expr arg) { return functions::rint(arg); }
+		/// Convert array of half-precision values to integers.
+		/// This works like the version without saturation policy, but can convert NaNs to zero instead.
+		/// \tparam R rounding mode to use.
+		/// \tparam S `true` for converting NaN to zero, `false` for converting it to the limit of its sign like half_cast()
+		/// \tparam T destination type (builtin integer type)
+		/// \param src array of values to convert
+		/// \param dst array to store converted values into
+		/// \param n number of values to convert
+		/// \param scale factor to multiply values with in single-precision before rounding
+		template<std::float_round_style R,bool S,typename T> void convert_int(const half *src, T *dst, std::size_t n, float scale = 1.0f)
+		{
+			bulk::half2int<R,HALF_ROUND_TIES_TO_EVEN,S>(src, dst, n, scale);
+		}
+		/// \}
 
-		/// Nearest integer using half's internal rounding mode.
-		/// \param arg half expression to round
-		/// \return nearest integer using default rounding mode
-//		template<typename T> typename enable<half,T>::type rint(T arg) { return functions::rint(arg); }
-		inline half rint(half arg) { return functions::rint(arg); }
-		inline half rint(expr arg) { return functions::rint(arg); }
+		/// \name Array mathematical functions
+		/// \{
 
-		/// Nearest integer using half's internal rounding mode.
-		/// \param arg half expression to round
-		/// \return nearest integer using default rounding mode
-//		template<typename T> typename enable<long,T>::type lrint(T arg) { return functions::lrint(arg); }
-		inline long lrint(half arg) { return functions::lrint(arg); }
-		inline long lrint(expr arg) { return functions::lrint(arg); }
-	#if HALF_ENABLE_CPP11_LONG_LONG
-		/// Nearest integer.
-		/// \param arg half to round
-		/// \return nearest integer, rounded away from zero in half-way cases
-//		template<typename T> typename enable<long long,T>::type llround(T arg) { return functions::llround(arg); }
-		inline long long llround(half arg) { return functions::llround(arg); }
-		inline long long llround(expr arg) { return functions::llround(arg); }
+		/// Exponential function for arrays.
+		/// This computes `half_cast<half>(std::exp(double(x)))` for each element, i.e. the correctly rounded function 
+		/// value, using the default rounding mode. But instead of going through `double` and the C++ standard library, it 
+		/// evaluates polynomials tuned for half-precision in SIMD registers and only falls back to `double` for the few 
+		/// results too close to a rounding boundary and for special arguments like NaN.
+		/// \param src array of function arguments
+		/// \param dst array to store function values into, may be equal to \a src
+		/// \param n number of elements
+		inline void exp(const half *src, half *dst, std::size_t n) { bulk::math<math_exp,(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(src, dst, n); }
+
+		/// Binary exponential for arrays.
+		/// This computes the correctly rounded values of `std::exp2` for each element like exp() does for arrays.
+		/// \param src array of function arguments
+		/// \param dst array to store function values into, may be equal to \a src
+		/// \param n number of elements
+		inline void exp2(const half *src, half *dst, std::size_t n) { bulk::math<math_exp2,(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(src, dst, n); }
+
+		/// Natural logarithm for arrays.
+		/// This computes the correctly rounded values of `std::log` for each element like exp() does for arrays.
+		/// \param src array of function arguments
+		/// \param dst array to store function values into, may be equal to \a src
+		/// \param n number of elements
+		inline void log(const half *src, half *dst, std::size_t n) { bulk::math<math_log,(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(src, dst, n); }
+
+		/// Binary logarithm for arrays.
+		/// This computes the correctly rounded values of `std::log2` for each element like exp() does for arrays.
+		/// \param src array of function arguments
+		/// \param dst array to store function values into, may be equal to \a src
+		/// \param n number of elements
+		inline void log2(const half *src, half *dst, std::size_t n) { bulk::math<math_log2,(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(src, dst, n); }
+
+		/// Square root for arrays.
+		/// This computes the correctly rounded values of `std::sqrt` for each element like exp() does for arrays.
+		/// \param src array of function arguments
+		/// \param dst array to store function values into, may be equal to \a src
+		/// \param n number of elements
+		inline void sqrt(const half *src, half *dst, std::size_t n) { bulk::math<math_sqrt,(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(src, dst, n); }
+
+		/// Sine function for arrays.
+		/// This computes the correctly rounded values of `std::sin` for each element like exp() does for arrays.
+		/// \param src array of function arguments
+		/// \param dst array to store function values into, may be equal to \a src
+		/// \param n number of elements
+		inline void sin(const half *src, half *dst, std::size_t n) { bulk::math<math_sin,(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(src, dst, n); }
+
+		/// Cosine function for arrays.
+		/// This computes the correctly rounded values of `std::cos` for each element like exp() does for arrays.
+		/// \param src array of function arguments
+		/// \param dst array to store function values into, may be equal to \a src
+		/// \param n number of elements
+		inline void cos(const half *src, half *dst, std::size_t n) { bulk::math<math_cos,(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(src, dst, n); }
+
+		/// Hyperbolic tangent for arrays.
+		/// This computes the correctly rounded values of `std::tanh` for each element like exp() does for arrays.
+		/// \param src array of function arguments
+		/// \param dst array to store function values into, may be equal to \a src
+		/// \param n number of elements
+		inline void tanh(const half *src, half *dst, std::size_t n) { bulk::math<math_tanh,(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(src, dst, n); }
+
+		/// Logistic sigmoid function for arrays.
+		/// This computes the correctly rounded values of `1/(1+exp(-x))` for each element like exp() does for arrays.
+		/// \param src array of function arguments
+		/// \param dst array to store function values into, may be equal to \a src
+		/// \param n number of elements
+		inline void sigmoid(const half *src, half *dst, std::size_t n) { bulk::math<math_sigmoid,(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(src, dst, n); }
+		/// \}
 
-		/// Nearest integer using half's internal rounding mode.
-		/// \param arg half expression to round
-		/// \return nearest integer using default rounding mode
-//		template<typename T> typename enable<long long,T>::type llrint(T arg) { return functions::llrint(arg); }
-		inline long long llrint(half arg) { return functions::llrint(arg); }
-		inline long long llrint(expr arg) { return functions::llrint(arg); }
-	#endif
+		/// \name Array sign and comparison functions
+		/// \{
 
+		/// Absolute value for arrays.
+		/// Like all array sign and comparison functions, this works directly on the binary representations using integer 
+		/// SIMD instructions, up to 32 halfs at once with AVX2, and thus computes exactly the same as the corresponding 
+		/// functions on individual halfs without ever converting to single-precision.
+		/// \param src array of arguments
+		/// \param dst array to store absolute values into, may be equal to \a src
+		/// \param n number of elements
+		inline void fabs(const half *src, half *dst, std::size_t n) { bulk::bitwise(src, src, dst, n, bits_fabs()); }
+
+		/// Negation for arrays.
+		/// \param src array of arguments
+		/// \param dst array to store negated values into, may be equal to \a src
+		/// \param n number of elements
+		inline void negate(const half *src, half *dst, std::size_t n) { bulk::bitwise(src, src, dst, n, bits_negate()); }
+
+		/// Take sign for arrays.
+		/// \param x array of values to change sign for
+		/// \param y array of values to take sign from
+		/// \param dst array to store results into, may be equal to \a x or \a y
+		/// \param n number of elements
+		inline void copysign(const half *x, const half *y, half *dst, std::size_t n) { bulk::bitwise(x, y, dst, n, bits_copysign()); }
+
+		/// Minimum for arrays.
+		/// Like fmin(), this returns the other operand if one is NaN. If both compare equal, as for zeros of different 
+		/// sign, the element of \a x is returned.
+		/// \param x first array of operands
+		/// \param y second array of operands
+		/// \param dst array to store minima into, may be equal to \a x or \a y
+		/// \param n number of elements
+		inline void fmin(const half *x, const half *y, half *dst, std::size_t n) { bulk::bitwise(x, y, dst, n, bits_extremum<false>()); }
+
+		/// Minimum of array and value.
+		/// \param x array of operands
+		/// \param y second operand for all elements
+		/// \param dst array to store minima into, may be equal to \a x
+		/// \param n number of elements
+		inline void fmin(const half *x, half y, half *dst, std::size_t n) { bulk::bitwise<bits_extremum<false> >(x, y, dst, n); }
+
+		/// Maximum for arrays.
+		/// Like fmax(), this returns the other operand if one is NaN. If both compare equal, as for zeros of different 
+		/// sign, the element of \a x is returned.
+		/// \param x first array of operands
+		/// \param y second array of operands
+		/// \param dst array to store maxima into, may be equal to \a x or \a y
+		/// \param n number of elements
+		inline void fmax(const half *x, const half *y, half *dst, std::size_t n) { bulk::bitwise(x, y, dst, n, bits_extremum<true>()); }
+
+		/// Maximum of array and value.
+		/// \param x array of operands
+		/// \param y second operand for all elements
+		/// \param dst array to store maxima into, may be equal to \a x
+		/// \param n number of elements
+		inline void fmax(const half *x, half y, half *dst, std::size_t n) { bulk::bitwise<bits_extremum<true> >(x, y, dst, n); }
+
+		/// Clamp array to range.
+		/// Like `std::clamp`, this returns \a lo for elements smaller than \a lo, \a hi for elements greater than \a hi and 
+		/// the element itself otherwise, which keeps NaNs.
+		/// \param src array of values to clamp
+		/// \param lo lower bound, must not be NaN
+		/// \param hi upper bound, must not be NaN or smaller than \a lo
+		/// \param dst array to store clamped values into, may be equal to \a src
+		/// \param n number of elements
+		inline void clamp(const half *src, half lo, half hi, half *dst, std::size_t n) { bulk::clamp(src, lo, hi, dst, n); }
+
+		/// Rectified linear unit for arrays.
+		/// This computes `max(x, 0)`, replacing negative values including negative zero by positive zero, but keeps NaNs.
+		/// \param src array of arguments
+		/// \param dst array to store results into, may be equal to \a src
+		/// \param n number of elements
+		inline void relu(const half *src, half *dst, std::size_t n) { bulk::bitwise(src, src, dst, n, bits_relu()); }
 		/// \}
-		/// \name Floating point manipulation
+
+		/// \name Array expressions
 		/// \{
 
-		/// Decompress floating point number.
-		/// \param arg number to decompress
-		/// \param exp address to store exponent at
-		/// \return significant in range [0.5, 1)
-//		template<typename T> typename enable<half,T>::type frexp(T arg, int *exp) { return functions::frexp(arg, exp); }
-		inline half frexp(half arg, int *exp) { return functions::frexp(arg, exp); }
-		inline half frexp(expr arg, int *exp) { return functions::frexp(arg, exp); }
+		/// Add array expressions.
+		/// Like all array expression operators this doesn't compute anything, but builds an expression that is evaluated 
+		/// in single-precision when assigned to a [half_span](\ref half_float::half_span).
+		/// \param x left operand
+		/// \param y right operand
+		/// \return lazy sum of array expressions
+		template<typename L,typename R> array_binary<array_plus,L,R> operator+(const array_expr<L> &x, const array_expr<R> &y) { return array_binary<array_plus,L,R>(x.self(), y.self()); }
 
-		/// Multiply by power of two.
-		/// \param arg number to modify
-		/// \param exp power of two to multiply with
-		/// \return \a arg multplied by 2 raised to \a exp
-//		template<typename T> typename enable<half,T>::type ldexp(T arg, int exp) { return functions::scalbln(arg, exp); }
-		inline half ldexp(half arg, int exp) { return functions::scalbln(arg, exp); }
-		inline half ldexp(expr arg, int exp) { return functions::scalbln(arg, exp); }
+		/// Add scalar to array expression.
+		/// \param x left operand
+		/// \param y right operand
+		/// \return lazy sum of array expression and scalar
+		template<typename L> array_binary<array_plus,L,array_scalar> operator+(const array_expr<L> &x, float y) { return array_binary<array_plus,L,array_scalar>(x.self(), array_scalar(y)); }
 
-		/// Extract integer and fractional parts.
-		/// \param arg number to decompress
-		/// \param iptr address to store integer part at
-		/// \return fractional part
-//		template<typename T> typename enable<half,T>::type modf(T arg, half *iptr) { return functions::modf(arg, iptr); }
-		inline half modf(half arg, half *iptr) { return functions::modf(arg, iptr); }
-		inline half modf(expr arg, half *iptr) { return functions::modf(arg, iptr); }
+		/// Add array expression to scalar.
+		/// \param x left operand
+		/// \param y right operand
+		/// \return lazy sum of scalar and array expression
+		template<typename R> array_binary<array_plus,array_scalar,R> operator+(float x, const array_expr<R> &y) { return array_binary<array_plus,array_scalar,R>(array_scalar(x), y.self()); }
 
-		/// Multiply by power of two.
-		/// \param arg number to modify
-		/// \param exp power of two to multiply with
-		/// \return \a arg multplied by 2 raised to \a exp
-//		template<typename T> typename enable<half,T>::type scalbn(T arg, int exp) { return functions::scalbln(arg, exp); }
-		inline half scalbn(half arg, int exp) { return functions::scalbln(arg, exp); }
-		inline half scalbn(expr arg, int exp) { return functions::scalbln(arg, exp); }
+		/// Subtract array expressions.
+		/// \param x left operand
+		/// \param y right operand
+		/// \return lazy difference of array expressions
+		template<typename L,typename R> array_binary<array_minus,L,R> operator-(const array_expr<L> &x, const array_expr<R> &y) { return array_binary<array_minus,L,R>(x.self(), y.self()); }
 
-		/// Multiply by power of two.
-		/// \param arg number to modify
-		/// \param exp power of two to multiply with
-		/// \return \a arg multplied by 2 raised to \a exp	
-//		template<typename T> typename enable<half,T>::type scalbln(T arg, long exp) { return functions::scalbln(arg, exp); }
-		inline half scalbln(half arg, long exp) { return functions::scalbln(arg, exp); }
-		inline half scalbln(expr arg, long exp) { return functions::scalbln(arg, exp); }
+		/// Subtract scalar from array expression.
+		/// \param x left operand
+		/// \param y right operand
+		/// \return lazy difference of array expression and scalar
+		template<typename L> array_binary<array_minus,L,array_scalar> operator-(const array_expr<L> &x, float y) { return array_binary<array_minus,L,array_scalar>(x.self(), array_scalar(y)); }
 
-		/// Extract exponent.
-		/// \param arg number to query
-		/// \return floating point exponent
-		/// \retval FP_ILOGB0 for zero
-		/// \retval FP_ILOGBNAN for NaN
-		/// \retval MAX_INT for infinity
-//		template<typename T> typename enable<int,T>::type ilogb(T arg) { return functions::ilogb(arg); }
-		inline int ilogb(half arg) { return functions::ilogb(arg); }
-		inline int ilogb(expr arg) { return functions::ilogb(arg); }
+		/// Subtract array expression from scalar.
+		/// \param x left operand
+		/// \param y right operand
+		/// \return lazy difference of scalar and array expression
+		template<typename R> array_binary<array_minus,array_scalar,R> operator-(float x, const array_expr<R> &y) { return array_binary<array_minus,array_scalar,R>(array_scalar(x), y.self()); }
 
-		/// Extract exponent.
-		/// \param arg number to query
-		/// \return floating point exponent
-//		template<typename T> typename enable<half,T>::type logb(T arg) { return functions::logb(arg); }
-		inline half logb(half arg) { return functions::logb(arg); }
-		inline half logb(expr arg) { return functions::logb(arg); }
+		/// Multiply array expressions.
+		/// \param x left operand
+		/// \param y right operand
+		/// \return lazy product of array expressions
+		template<typename L,typename R> array_binary<array_multiplies,L,R> operator*(const array_expr<L> &x, const array_expr<R> &y) { return array_binary<array_multiplies,L,R>(x.self(), y.self()); }
 
-		/// Next representable value.
-		/// \param from value to compute next representable value for
-		/// \param to direction towards which to compute next value
-		/// \return next representable value after \a from in direction towards \a to
-//		template<typename T,typename U> typename enable<half,T,U>::type nextafter(T from, U to) { return functions::nextafter(from, to); }
-		inline half nextafter(half from, half to) { return functions::nextafter(from, to); }
-		inline half nextafter(half from, expr to) { return functions::nextafter(from, to); }
-		inline half nextafter(expr from, half to) { return functions::nextafter(from, to); }
-		inline half nextafter(expr from, expr to) { return functions::nextafter(from, to); }
+		/// Multiply array expression by scalar.
+		/// \param x left operand
+		/// \param y right operand
+		/// \return lazy product of array expression and scalar
+		template<typename L> array_binary<array_multiplies,L,array_scalar> operator*(const array_expr<L> &x, float y) { return array_binary<array_multiplies,L,array_scalar>(x.self(), array_scalar(y)); }
 
-		/// Next representable value.
-		/// \param from value to compute next representable value for
-		/// \param to direction towards which to compute next value
-		/// \return next representable value after \a from in direction towards \a to
-//		template<typename T> typename enable<half,T>::type nexttoward(T from, long double to) { return functions::nexttoward(from, to); }
-		inline half nexttoward(half from, long double to) { return functions::nexttoward(from, to); }
-		inline half nexttoward(expr from, long double to) { return functions::nexttoward(from, to); }
+		/// Multiply scalar by array expression.
+		/// \param x left operand
+		/// \param y right operand
+		/// \return lazy product of scalar and array expression
+		template<typename R> array_binary<array_multiplies,array_scalar,R> operator*(float x, const array_expr<R> &y) { return array_binary<array_multiplies,array_scalar,R>(array_scalar(x), y.self()); }
+
+		/// Divide array expressions.
+		/// \param x left operand
+		/// \param y right operand
+		/// \return lazy quotient of array expressions
+		template<typename L,typename R> array_binary<array_divides,L,R> operator/(const array_expr<L> &x, const array_expr<R> &y) { return array_binary<array_divides,L,R>(x.self(), y.self()); }
+
+		/// Divide array expression by scalar.
+		/// \param x left operand
+		/// \param y right operand
+		/// \return lazy quotient of array expression and scalar
+		template<typename L> array_binary<array_divides,L,array_scalar> operator/(const array_expr<L> &x, float y) { return array_binary<array_divides,L,array_scalar>(x.self(), array_scalar(y)); }
+
+		/// Divide scalar by array expression.
+		/// \param x left operand
+		/// \param y right operand
+		/// \return lazy quotient of scalar and array expression
+		template<typename R> array_binary<array_divides,array_scalar,R> operator/(float x, const array_expr<R> &y) { return array_binary<array_divides,array_scalar,R>(array_scalar(x), y.self()); }
+
+		/// Negate array expression.
+		/// \param arg operand
+		/// \return lazy negated array expression
+		template<typename E> array_unary<array_negate,E> operator-(const array_expr<E> &arg) { return array_unary<array_negate,E>(arg.self()); }
+
+		/// Absolute value of array expression.
+		/// \param arg operand
+		/// \return lazy absolute values of array expression
+		template<typename E> array_unary<array_abs,E> abs(const array_expr<E> &arg) { return array_unary<array_abs,E>(arg.self()); }
+
+		/// Square root of array expression.
+		/// Unlike the [array version](\ref half_float::sqrt(const half*,half*,std::size_t)) this is computed in 
+		/// single-precision as part of the expression, which is still correctly rounded if the operand is a plain array.
+		/// \param arg operand
+		/// \return lazy square roots of array expression
+		template<typename E> array_unary<array_sqrt,E> sqrt(const array_expr<E> &arg) { return array_unary<array_sqrt,E>(arg.self()); }
+		/// \}
 
-		/// Take sign.
-		/// \param x value to change sign for
-		/// \param y value to take sign from
-		/// \return value equal to \a x in magnitude and to \a y in sign
-//		template<typename T,typename U> typename enable<half,T,U>::type copysign(T x, U y) { return functions::copysign(x, y); }
-		inline half copysign(half x, half y) { return functions::copysign(x, y); }
-		inline half copysign(half x, expr y) { return functions::copysign(x, y); }
-		inline half copysign(expr x, half y) { return functions::copysign(x, y); }
-		inline half copysign(expr x, expr y) { return functions::copysign(x, y); }
+		/// \name Linear algebra
+		/// \{
+
+		/// Dot product of half-precision arrays.
+		/// This accumulates the products in single-precision using several partial sums, converting the operands with F16C 
+		/// instructions if available. Since products of halfs are exact in single-precision, this is much more accurate 
+		/// (and faster) than accumulating into a half, but due to the partial sums the result may differ slightly from a 
+		/// sequential single-precision summation.
+		/// \param x first array
+		/// \param y second array
+		/// \param n number of elements
+		/// \return sum of products
+		inline float dot(const half *x, const half *y, std::size_t n) { return bulk::dot<float>(x, y, n); }
+
+		/// Dot product of half-precision arrays with explicit accumulator type.
+		/// This works like the [single-precision version](\ref half_float::dot(const half*,const half*,std::size_t)), but 
+		/// accumulates in the given type, e.g. `dot<double>(x, y, n)`.
+		/// \tparam T type to accumulate in and return, `float` or `double`
+		/// \param x first array
+		/// \param y second array
+		/// \param n number of elements
+		/// \return sum of products
+		template<typename T> T dot(const half *x, const half *y, std::size_t n) { return bulk::dot<T>(x, y, n); }
+
+		/// Scaled addition of half-precision arrays.
+		/// This computes `y[i] = alpha*x[i] + y[i]` in single-precision and rounds each result to half-precision only 
+		/// once using the default rounding mode.
+		/// \param alpha factor for \a x
+		/// \param x array to add
+		/// \param y array to add to and store results into, may be equal to \a x
+		/// \param n number of elements
+		inline void axpy(float alpha, const half *x, half *y, std::size_t n) { bulk::axpy<(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(alpha, x, y, n); }
+
+		/// Matrix-vector product of half-precision arrays.
+		/// This computes `y = alpha*A*x + beta*y` for the row-major \a m x \a n matrix `A`, accumulating each element like 
+		/// dot() in single-precision and rounding it to half-precision only once using the default rounding mode. The vector 
+		/// is converted to single-precision only once for all rows, which are spread over the threads of the pool configured 
+		/// by set_parallel_threads() for large matrices. Like in BLAS, \a y isn't read if \a beta is zero.
+		/// \param m number of rows
+		/// \param n number of columns
+		/// \param alpha factor for matrix-vector product
+		/// \param a row-major matrix
+		/// \param lda distance between rows of \a a in elements
+		/// \param x vector of \a n elements to multiply with
+		/// \param beta factor for \a y
+		/// \param y vector of \a m elements to add to and store results into, must not overlap \a a or \a x
+		inline void gemv(std::size_t m, std::size_t n, float alpha, const half *a, std::size_t lda, const half *x, float beta, half *y)
+		{
+			gemv_blocking<float,(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(m, n, alpha, a, lda, x, beta, y).run();
+		}
+
+		/// Matrix-vector product of half-precision arrays with explicit accumulator type.
+		/// This works like the [single-precision version](\ref half_float::gemv(std::size_t,std::size_t,float,const half*,std::size_t,const half*,float,half*)), 
+		/// but accumulates and scales in the given type, e.g. `gemv<double>(...)`.
+		/// \tparam T type to accumulate in, `float` or `double`
+		/// \param m number of rows
+		/// \param n number of columns
+		/// \param alpha factor for matrix-vector product
+		/// \param a row-major matrix
+		/// \param lda distance between rows of \a a in elements
+		/// \param x vector of \a n elements to multiply with
+		/// \param beta factor for \a y
+		/// \param y vector of \a m elements to add to and store results into, must not overlap \a a or \a x
+		template<typename T> void gemv(std::size_t m, std::size_t n, float alpha, const half *a, std::size_t lda, const half *x, float beta, half *y)
+		{
+			gemv_blocking<T,(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(m, n, alpha, a, lda, x, beta, y).run();
+		}
 
+		/// Matrix multiplication of half-precision arrays.
+		/// This computes `C = alpha*A*B + beta*C` for the row-major \a m x \a k matrix `A`, \a k x \a n matrix `B` and 
+		/// \a m x \a n matrix `C`. The matrices are multiplied in cache-sized blocks, which are converted to 
+		/// single-precision and packed into panels for register-blocked AVX or SSE2 kernels, spread over the threads of 
+		/// the pool configured by set_parallel_threads() for large matrices. Each element is accumulated in 
+		/// single-precision and rounded to half-precision only once using the default rounding mode. Each element's sum 
+		/// is always accumulated in the same order, so results don't depend on the number of threads. Between instruction 
+		/// sets they can still differ if the compiler contracts multiplications and additions into fused multiply-adds. 
+		/// Like in BLAS, \a c isn't read if \a beta is zero. Column-major matrices can be multiplied by swapping the 
+		/// operands, since `C^T = B^T*A^T`.
+		/// \param m number of rows of \a a and \a c
+		/// \param n number of columns of \a b and \a c
+		/// \param k number of columns of \a a and rows of \a b
+		/// \param alpha factor for matrix product
+		/// \param a row-major left matrix
+		/// \param lda distance between rows of \a a in elements
+		/// \param b row-major right matrix
+		/// \param ldb distance between rows of \a b in elements
+		/// \param beta factor for \a c
+		/// \param c row-major matrix to add to and store results into, must not overlap \a a or \a b
+		/// \param ldc distance between rows of \a c in elements
+		inline void gemm(std::size_t m, std::size_t n, std::size_t k, float alpha, const half *a, std::size_t lda, 
+			const half *b, std::size_t ldb, float beta, half *c, std::size_t ldc)
+		{
+		#if HALF_ENABLE_F16C_INTRINSICS
+			if(cpu_supports(cpu_f16c))
+				return gemm_blocking<gemm_kernel_avx,(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(
+					m, n, k, alpha, a, lda, b, ldb, beta, c, ldc).run();
+		#endif
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			gemm_blocking<gemm_kernel_sse2,(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc).run();
+		#else
+			gemm_blocking<gemm_kernel,(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc).run();
+		#endif
+		}
 		/// \}
-		/// \name Floating point classification
+
+		/// \name Reductions
 		/// \{
 
+		/// Sum of half-precision array.
+		/// This converts blocks of the array to single-precision, sums them in SIMD registers and accumulates the block sums 
+		/// using compensated summation, which is much more accurate than a plain single-precision loop.
+		/// \param data array to sum
+		/// \param n number of elements
+		/// \return sum of elements
+		inline float sum(const half *data, std::size_t n) { return reduce<sum_reduction<false> >(data, n, false).value(); }
+
+		/// Mean of half-precision array.
+		/// \param data array to average
+		/// \param n number of elements
+		/// \return arithmetic mean of elements, NaN if \a n is 0
+		inline float mean(const half *data, std::size_t n) { return reduce<sum_reduction<false> >(data, n, false).value() / static_cast<float>(n); }
+
+		/// Variance of half-precision array.
+		/// This computes the population variance, i.e. the mean squared deviation from the mean, by combining the means and 
+		/// squared deviations of blocks, which avoids the cancellation of computing it from the sum of squares.
+		/// \param data array to compute variance of
+		/// \param n number of elements
+		/// \return variance of elements, NaN if \a n is 0
+		inline float variance(const half *data, std::size_t n) { return reduce<variance_reduction>(data, n, false).m2 / static_cast<float>(n); }
+
+		/// Euclidean norm of half-precision array.
+		/// Since squares of halfs are exact in single-precision and a single-precision sum of squares can neither overflow 
+		/// nor underflow for any number of halfs, this needs no rescaling like hypot() does, and is computed like sum().
+		/// \param data array to compute norm of
+		/// \param n number of elements
+		/// \return square root of sum of squares of elements
+		inline float nrm2(const half *data, std::size_t n) { return std::sqrt(reduce<sum_reduction<true> >(data, n, false).value()); }
+
+		/// Minimum of half-precision array.
+		/// This compares the binary representations as integers in SIMD registers. NaNs are ignored and negative zero is 
+		/// considered smaller than positive zero.
+		/// \param data array to search
+		/// \param n number of elements
+		/// \return smallest element, NaN if \a n is 0 or all elements are NaN
+		inline half minimum(const half *data, std::size_t n)
+		{
+			int key = reduce<extremum_reduction<false> >(data, n, false).key;
+			return (key == INT_MAX) ? functions::nanh() : bulk::from_key(key);
+		}
 
-		/// Classify floating point value.
-		/// \param arg number to classify
-		/// \retval FP_ZERO for positive and negative zero
-		/// \retval FP_SUBNORMAL for subnormal numbers
-		/// \retval FP_INFINITY for positive and negative infinity
-		/// \retval FP_NAN for NaNs
-		/// \retval FP_NORMAL for all other (normal) values
-//		template<typename T> typename enable<int,T>::type fpclassify(T arg) { return functions::fpclassify(arg); }
-		inline int fpclassify(half arg) { return functions::fpclassify(arg); }
-		inline int fpclassify(expr arg) { return functions::fpclassify(arg); }
+		/// Maximum of half-precision array.
+		/// Like minimum(), NaNs are ignored and negative zero is considered smaller than positive zero.
+		/// \param data array to search
+		/// \param n number of elements
+		/// \return largest element, NaN if \a n is 0 or all elements are NaN
+		inline half maximum(const half *data, std::size_t n)
+		{
+			int key = reduce<extremum_reduction<true> >(data, n, false).key;
+			return (key == INT_MIN) ? functions::nanh() : bulk::from_key(key);
+		}
 
-		/// Check if finite number.
-		/// \param arg number to check
-		/// \retval true if neither infinity nor NaN
-		/// \retval false else
-//		template<typename T> typename enable<bool,T>::type isfinite(T arg) { return functions::isfinite(arg); }
-		inline bool isfinite(half arg) { return functions::isfinite(arg); }
-		inline bool isfinite(expr arg) { return functions::isfinite(arg); }
+		/// Index of minimum of half-precision array.
+		/// Like minimum(), NaNs are ignored and negative zero is considered smaller than positive zero.
+		/// \param data array to search
+		/// \param n number of elements
+		/// \return index of first smallest element, \a n if \a n is 0 or all elements are NaN
+		inline std::size_t argmin(const half *data, std::size_t n)
+		{
+			extremum_reduction<false>::state s = reduce<extremum_reduction<false> >(data, n, false);
+			return (s.key == INT_MAX) ? n : s.index;
+		}
 
-		/// Check for infinity.
-		/// \param arg number to check
-		/// \retval true for positive or negative infinity
-		/// \retval false else
-//		template<typename T> typename enable<bool,T>::type isinf(T arg) { return functions::isinf(arg); }
-		inline bool isinf(half arg) { return functions::isinf(arg); }
-		inline bool isinf(expr arg) { return functions::isinf(arg); }
+		/// Index of maximum of half-precision array.
+		/// Like minimum(), NaNs are ignored and negative zero is considered smaller than positive zero.
+		/// \param data array to search
+		/// \param n number of elements
+		/// \return index of first largest element, \a n if \a n is 0 or all elements are NaN
+		inline std::size_t argmax(const half *data, std::size_t n)
+		{
+			extremum_reduction<true>::state s = reduce<extremum_reduction<true> >(data, n, false);
+			return (s.key == INT_MIN) ? n : s.index;
+		}
+		/// \}
+		/// \name Parallel reductions
+		/// \{
 
-		/// Check for NaN.
-		/// \param arg number to check
-		/// \retval true for NaNs
-		/// \retval false else
-//		template<typename T> typename enable<bool,T>::type isnan(T arg) { return functions::isnan(arg); }
-		inline bool isnan(half arg) { return functions::isnan(arg); }
-		inline bool isnan(expr arg) { return functions::isnan(arg); }
+		/// Sum of half-precision array using multiple threads.
+		/// The array is split into chunks that are reduced in parallel using the pool configured by 
+		/// set_parallel_threads(), like in convert_parallel(). The chunk results are combined in order and the 
+		/// single-threaded version combines its chunks the same way, so results are exactly the same as sum().
+		/// \param data array to sum
+		/// \param n number of elements
+		/// \return sum of elements
+		inline float sum_parallel(const half *data, std::size_t n) { return reduce<sum_reduction<false> >(data, n, true).value(); }
+
+		/// Mean of half-precision array using multiple threads.
+		/// This computes the same result as mean() like sum_parallel() does.
+		/// \param data array to average
+		/// \param n number of elements
+		/// \return arithmetic mean of elements, NaN if \a n is 0
+		inline float mean_parallel(const half *data, std::size_t n) { return reduce<sum_reduction<false> >(data, n, true).value() / static_cast<float>(n); }
+
+		/// Variance of half-precision array using multiple threads.
+		/// This computes the same result as variance() like sum_parallel() does.
+		/// \param data array to compute variance of
+		/// \param n number of elements
+		/// \return variance of elements, NaN if \a n is 0
+		inline float variance_parallel(const half *data, std::size_t n) { return reduce<variance_reduction>(data, n, true).m2 / static_cast<float>(n); }
+
+		/// Euclidean norm of half-precision array using multiple threads.
+		/// This computes the same result as nrm2() like sum_parallel() does.
+		/// \param data array to compute norm of
+		/// \param n number of elements
+		/// \return square root of sum of squares of elements
+		inline float nrm2_parallel(const half *data, std::size_t n) { return std::sqrt(reduce<sum_reduction<true> >(data, n, true).value()); }
+
+		/// Minimum of half-precision array using multiple threads.
+		/// This computes the same result as minimum() like sum_parallel() does.
+		/// \param data array to search
+		/// \param n number of elements
+		/// \return smallest element, NaN if \a n is 0 or all elements are NaN
+		inline half minimum_parallel(const half *data, std::size_t n)
+		{
+			int key = reduce<extremum_reduction<false> >(data, n, true).key;
+			return (key == INT_MAX) ? functions::nanh() : bulk::from_key(key);
+		}
 
-		/// Check if normal number.
-		/// \param arg number to check
-		/// \retval true if normal number
-		/// \retval false if either subnormal, zero, infinity or NaN
-//		template<typename T> typename enable<bool,T>::type isnormal(T arg) { return functions::isnormal(arg); }
-		inline bool isnormal(half arg) { return functions::isnormal(arg); }
-		inline bool isnormal(expr arg) { return functions::isnormal(arg); }
+		/// Maximum of half-precision array using multiple threads.
+		/// This computes the same result as maximum() like sum_parallel() does.
+		/// \param data array to search
+		/// \param n number of elements
+		/// \return largest element, NaN if \a n is 0 or all elements are NaN
+		inline half maximum_parallel(const half *data, std::size_t n)
+		{
+			int key = reduce<extremum_reduction<true> >(data, n, true).key;
+			return (key == INT_MIN) ? functions::nanh() : bulk::from_key(key);
+		}
 
-		/// Check sign.
-		/// \param arg number to check
-		/// \retval true for negative number
-		/// \retval false for positive number
-//		template<typename T> typename enable<bool,T>::type signbit(T arg) { return functions::signbit(arg); }
-		inline bool signbit(half arg) { return functions::signbit(arg); }
-		inline bool signbit(expr arg) { return functions::signbit(arg); }
+		/// Index of minimum of half-precision array using multiple threads.
+		/// This computes the same result as argmin() like sum_parallel() does.
+		/// \param data array to search
+		/// \param n number of elements
+		/// \return index of first smallest element, \a n if \a n is 0 or all elements are NaN
+		inline std::size_t argmin_parallel(const half *data, std::size_t n)
+		{
+			extremum_reduction<false>::state s = reduce<extremum_reduction<false> >(data, n, true);
+			return (s.key == INT_MAX) ? n : s.index;
+		}
 
+		/// Index of maximum of half-precision array using multiple threads.
+		/// This computes the same result as argmax() like sum_parallel() does.
+		/// \param data array to search
+		/// \param n number of elements
+		/// \return index of first largest element, \a n if \a n is 0 or all elements are NaN
+		inline std::size_t argmax_parallel(const half *data, std::size_t n)
+		{
+			extremum_reduction<true>::state s = reduce<extremum_reduction<true> >(data, n, true);
+			return (s.key == INT_MIN) ? n : s.index;
+		}
 		/// \}
-		/// \name Comparison
+
+		/// \name Exact reductions
 		/// \{
 
-		/// Comparison for greater than.
-		/// \param x first operand
-		/// \param y second operand
-		/// \retval true if \a x greater than \a y
-		/// \retval false else
-//		template<typename T,typename U> typename enable<bool,T,U>::type isgreater(T x, U y) { return functions::isgreater(x, y); }
-		inline bool isgreater(half x, half y) { return functions::isgreater(x, y); }
-		inline bool isgreater(half x, expr y) { return functions::isgreater(x, y); }
-		inline bool isgreater(expr x, half y) { return functions::isgreater(x, y); }
-		inline bool isgreater(expr x, expr y) { return functions::isgreater(x, y); }
+		/// Exact sum of half-precision array.
+		/// This accumulates the elements exactly in an exact_accumulator and rounds the sum only once, so the result 
+		/// doesn't depend on the order of the elements.
+		/// \param data array to sum
+		/// \param n number of elements
+		/// \return correctly rounded sum of elements
+		inline float exact_sum(const half *data, std::size_t n) { return exact_accumulate(data, NULL, n, false).value<float>(); }
+
+		/// Exact sum of half-precision array with explicit result type.
+		/// This works like the [single-precision version](\ref half_float::exact_sum(const half*,std::size_t)), but 
+		/// rounds the sum to the given type, e.g. `exact_sum<half>(data, n)`.
+		/// \tparam T type to return, `half`, `float` or `double`
+		/// \param data array to sum
+		/// \param n number of elements
+		/// \return correctly rounded sum of elements
+		template<typename T> T exact_sum(const half *data, std::size_t n) { return exact_accumulate(data, NULL, n, false).template value<T>(); }
+
+		/// Exact dot product of half-precision arrays.
+		/// This accumulates the products exactly in an exact_accumulator and rounds the sum only once, so the result 
+		/// doesn't depend on the order of the elements.
+		/// \param x first array
+		/// \param y second array
+		/// \param n number of elements
+		/// \return correctly rounded sum of products
+		inline float exact_dot(const half *x, const half *y, std::size_t n) { return exact_accumulate(x, y, n, false).value<float>(); }
+
+		/// Exact dot product of half-precision arrays with explicit result type.
+		/// This works like the [single-precision version](\ref half_float::exact_dot(const half*,const half*,std::size_t)), 
+		/// but rounds the sum to the given type, e.g. `exact_dot<double>(x, y, n)`.
+		/// \tparam T type to return, `half`, `float` or `double`
+		/// \param x first array
+		/// \param y second array
+		/// \param n number of elements
+		/// \return correctly rounded sum of products
+		template<typename T> T exact_dot(const half *x, const half *y, std::size_t n) { return exact_accumulate(x, y, n, false).template value<T>(); }
+
+		/// Exact sum of half-precision array using multiple threads.
+		/// The array is split into chunks that are accumulated in parallel using the pool configured by 
+		/// set_parallel_threads(). Since the accumulation is exact, the result is always the same as exact_sum().
+		/// \param data array to sum
+		/// \param n number of elements
+		/// \return correctly rounded sum of elements
+		inline float exact_sum_parallel(const half *data, std::size_t n) { return exact_accumulate(data, NULL, n, true).value<float>(); }
+
+		/// Exact sum of half-precision array with explicit result type using multiple threads.
+		/// \tparam T type to return, `half`, `float` or `double`
+		/// \param data array to sum
+		/// \param n number of elements
+		/// \return correctly rounded sum of elements
+		template<typename T> T exact_sum_parallel(const half *data, std::size_t n) { return exact_accumulate(data, NULL, n, true).template value<T>(); }
+
+		/// Exact dot product of half-precision arrays using multiple threads.
+		/// This computes the same result as exact_dot() like exact_sum_parallel() does.
+		/// \param x first array
+		/// \param y second array
+		/// \param n number of elements
+		/// \return correctly rounded sum of products
+		inline float exact_dot_parallel(const half *x, const half *y, std::size_t n) { return exact_accumulate(x, y, n, true).value<float>(); }
+
+		/// Exact dot product of half-precision arrays with explicit result type using multiple threads.
+		/// \tparam T type to return, `half`, `float` or `double`
+		/// \param x first array
+		/// \param y second array
+		/// \param n number of elements
+		/// \return correctly rounded sum of products
+		template<typename T> T exact_dot_parallel(const half *x, const half *y, std::size_t n) { return exact_accumulate(x, y, n, true).template value<T>(); }
+		/// \}
 
-		/// Comparison for greater equal.
-		/// \param x first operand
-		/// \param y second operand
-		/// \retval true if \a x greater equal \a y
-		/// \retval false else
-//		template<typename T,typename U> typename enable<bool,T,U>::type isgreaterequal(T x, U y) { return functions::isgreaterequal(x, y); }
-		inline bool isgreaterequal(half x, half y) { return functions::isgreaterequal(x, y); }
-		inline bool isgreaterequal(half x, expr y) { return functions::isgreaterequal(x, y); }
-		inline bool isgreaterequal(expr x, half y) { return functions::isgreaterequal(x, y); }
-		inline bool isgreaterequal(expr x, expr y) { return functions::isgreaterequal(x, y); }
+		/// \name Sorting
+		/// \{
 
-		/// Comparison for less than.
-		/// \param x first operand
-		/// \param y second operand
-		/// \retval true if \a x less than \a y
-		/// \retval false else
-//		template<typename T,typename U> typename enable<bool,T,U>::type isless(T x, U y) { return functions::isless(x, y); }
-		inline bool isless(half x, half y) { return functions::isless(x, y); }
-		inline bool isless(half x, expr y) { return functions::isless(x, y); }
-		inline bool isless(expr x, half y) { return functions::isless(x, y); }
-		inline bool isless(expr x, expr y) { return functions::isless(x, y); }
+		/// Sort half-precision array.
+		/// Instead of comparing halfs, this sorts integer keys derived from their binary representations, using a radix 
+		/// sort for smaller arrays and a counting sort for larger ones, both in linear time. The order is total: negative 
+		/// zero comes before positive zero and NaNs come last, first the positive ones in ascending and then the negative 
+		/// ones in descending order of their payloads.
+		/// \param data array to sort
+		/// \param n number of elements
+		inline void sort(half *data, std::size_t n)
+		{
+			if(n < 2)
+				return;
+			std::vector<uint16> keys(n);
+			bulk::sort_keys(data, &keys[0], n);
+			sort_keys(&keys[0], n);
+			bulk::sort_values(&keys[0], data, n);
+		}
 
-		/// Comparison for less equal.
-		/// \param x first operand
-		/// \param y second operand
-		/// \retval true if \a x less equal \a y
-		/// \retval false else
-//		template<typename T,typename U> typename enable<bool,T,U>::type islessequal(T x, U y) { return functions::islessequal(x, y); }
-		inline bool islessequal(half x, half y) { return functions::islessequal(x, y); }
-		inline bool islessequal(half x, expr y) { return functions::islessequal(x, y); }
-		inline bool islessequal(expr x, half y) { return functions::islessequal(x, y); }
-		inline bool islessequal(expr x, expr y) { return functions::islessequal(x, y); }
+		/// Sort half-precision keys and associated values.
+		/// This sorts the keys in the same order as sort() using a radix sort and reorders the values the same way. The 
+		/// sort is stable, i.e. values with equal keys keep their order.
+		/// \tparam T value type, must be default-constructible and assignable
+		/// \param keys array of keys to sort
+		/// \param values array of values to reorder
+		/// \param n number of elements
+		template<typename T> void sort(half *keys, T *values, std::size_t n)
+		{
+			if(n < 2)
+				return;
+			std::vector<uint16> k(n);
+			bulk::sort_keys(keys, &k[0], n);
+			radix_sort(&k[0], values, n);
+			bulk::sort_values(&k[0], keys, n);
+		}
 
-		/// Comarison for less or greater.
-		/// \param x first operand
-		/// \param y second operand
-		/// \retval true if either less or greater
-		/// \retval false else
-//		template<typename T,typename U> typename enable<bool,T,U>::type islessgreater(T x, U y) { return functions::islessgreater(x, y); }
-		inline bool islessgreater(half x, half y) { return functions::islessgreater(x, y); }
-		inline bool islessgreater(half x, expr y) { return functions::islessgreater(x, y); }
-		inline bool islessgreater(expr x, half y) { return functions::islessgreater(x, y); }
-		inline bool islessgreater(expr x, expr y) { return functions::islessgreater(x, y); }
+		/// Indices sorting half-precision array.
+		/// This computes the stable permutation sorting the array in the same order as sort().
+		/// \param data array to compute sorting permutation for
+		/// \param indices array to store indices of elements in sorted order into
+		/// \param n number of elements
+		inline void argsort(const half *data, std::size_t *indices, std::size_t n)
+		{
+			if(!n)
+				return;
+			std::vector<uint16> keys(n);
+			bulk::sort_keys(data, &keys[0], n);
+			for(std::size_t i=0; i<n; ++i)
+				indices[i] = i;
+			radix_sort(&keys[0], indices, n);
+		}
 
-		/// Check if unordered.
-		/// \param x first operand
-		/// \param y second operand
-		/// \retval true if unordered (one or two NaN operands)
-		/// \retval false else
-//		template<typename T,typename U> typename enable<bool,T,U>::type isunordered(T x, U y) { return functions::isunordered(x, y); }
-		inline bool isunordered(half x, half y) { return functions::isunordered(x, y); }
-		inline bool isunordered(half x, expr y) { return functions::isunordered(x, y); }
-		inline bool isunordered(expr x, half y) { return functions::isunordered(x, y); }
-		inline bool isunordered(expr x, expr y) { return functions::isunordered(x, y); }
+		/// Partially sort half-precision array.
+		/// This moves the \a k smallest elements to the front of the array in sorted order, like `std::partial_sort` and 
+		/// in the same order as sort(). The remaining elements keep their relative order. The elements are selected using 
+		/// two histograms in linear time, so only the \a k selected ones need to be sorted.
+		/// \param data array to partially sort
+		/// \param n number of elements
+		/// \param k number of smallest elements to sort
+		inline void partial_sort(half *data, std::size_t n, std::size_t k)
+		{
+			if(k >= n)
+				return sort(data, n);
+			if(!k)
+				return;
+			std::vector<uint16> keys(n);
+			bulk::sort_keys(data, &keys[0], n);
+			select_keys(&keys[0], static_cast<uint16*>(NULL), n, k);
+			radix_sort(&keys[0], static_cast<uint16*>(NULL), k);
+			bulk::sort_values(&keys[0], data, n);
+		}
 
-		/// \name Casting
+		/// Indices of largest elements of half-precision array.
+		/// This selects the \a k largest elements in the order of sort(), so NaNs are considered larger than any other 
+		/// value. Of equal elements the ones with smaller index are preferred.
+		/// \param data array to select from
+		/// \param n number of elements
+		/// \param k number of largest elements to select
+		/// \param indices array to store indices of the min(\a k, \a n) largest elements into, in descending order of 
+		/// their values and ascending order of equal values' indices
+		inline void top_k(const half *data, std::size_t n, std::size_t k, std::size_t *indices)
+		{
+			k = std::min(k, n);
+			if(!k)
+				return;
+			std::vector<uint16> keys(n);
+			std::vector<std::size_t> index(n);
+			bulk::sort_keys(data, &keys[0], n, true);
+			for(std::size_t i=0; i<n; ++i)
+				index[i] = i;
+			select_keys(&keys[0], &index[0], n, k);
+			radix_sort(&keys[0], &index[0], k);
+			std::copy(index.begin(), index.begin()+k, indices);
+		}
+		/// \}
+
+	#if HALF_ENABLE_FLOAT16
+		/// \name Native half-precision interoperability
 		/// \{
 
-		/// Cast to or from half-precision floating point number.
-		/// This casts between [half](\ref half_float::half) and any built-in arithmetic type. The values are converted 
-		/// directly using the given rounding mode, without any roundtrip over `float` that a `static_cast` would otherwise do. 
-		/// It uses the default rounding mode.
-		///
-		/// Using this cast with neither of the two types being a [half](\ref half_float::half) or with any of the two types 
-		/// not being a built-in arithmetic type (apart from [half](\ref half_float::half), of course) results in a compiler 
-		/// error and casting between [half](\ref half_float::half)s is just a no-op.
-		/// \tparam T destination type (half or built-in arithmetic type)
-		/// \tparam U source type (half or built-in arithmetic type)
-		/// \param arg value to cast
-		/// \return \a arg converted to destination type
-		template<typename T,typename U> T half_cast(U arg) { return half_caster<T,U>::cast(arg); }
+		/// Reinterpret half as native half-precision value.
+		/// This only copies the binary representation and thus preserves every value exactly, including NaN payloads.
+		/// \param arg half to convert
+		/// \return native half-precision value with same binary representation
+		inline native_half native_cast(half arg)
+		{
+			native_half out;
+			std::memcpy(&out, &arg, sizeof(native_half));
+			return out;
+		}
 
-		/// Cast to or from half-precision floating point number.
-		/// This casts between [half](\ref half_float::half) and any built-in arithmetic type. The values are converted 
-		/// directly using the given rounding mode, without any roundtrip over `float` that a `static_cast` would otherwise do.
-		///
-		/// Using this cast with neither of the two types being a [half](\ref half_float::half) or with any of the two types 
-		/// not being a built-in arithmetic type (apart from [half](\ref half_float::half), of course) results in a compiler 
-		/// error and casting between [half](\ref half_float::half)s is just a no-op.
-		/// \tparam T destination type (half or built-in arithmetic type)
-		/// \tparam R rounding mode to use.
-		/// \tparam U source type (half or built-in arithmetic type)
-		/// \param arg value to cast
-		/// \return \a arg converted to destination type
-		template<typename T,std::float_round_style R,typename U> T half_cast(U arg) { return half_caster<T,U,R>::cast(arg); }
+		/// Reinterpret native half-precision value as half.
+		/// This only copies the binary representation and thus preserves every value exactly, including NaN payloads.
+		/// \param arg native half-precision value to convert
+		/// \return half with same binary representation
+		inline half native_cast(native_half arg)
+		{
+			half out;
+			std::memcpy(static_cast<void*>(&out), &arg, sizeof(native_half));
+			return out;
+		}
+
+		/// Reinterpret array of halfs as array of native half-precision values.
+		/// This doesn't copy or convert anything but just reinterprets the memory, which is possible since both types have 
+		/// the same binary representation, so spans of halfs can be passed to code using the native type and vice versa.
+		/// \param data pointer to array of halfs
+		/// \return pointer to same array as native half-precision values
+		inline native_half* native_cast(half *data) { return reinterpret_cast<native_half*>(data); }
+
+		/// Reinterpret array of halfs as array of native half-precision values.
+		/// \param data pointer to array of halfs
+		/// \return pointer to same array as native half-precision values
+		inline const native_half* native_cast(const half *data) { return reinterpret_cast<const native_half*>(data); }
+
+		/// Reinterpret array of native half-precision values as array of halfs.
+		/// \param data pointer to array of native half-precision values
+		/// \return pointer to same array as halfs
+		inline half* native_cast(native_half *data) { return reinterpret_cast<half*>(data); }
+
+		/// Reinterpret array of native half-precision values as array of halfs.
+		/// \param data pointer to array of native half-precision values
+		/// \return pointer to same array as halfs
+		inline const half* native_cast(const native_half *data) { return reinterpret_cast<const half*>(data); }
 		/// \}
+	#endif
+	}
+
+	/// Lookup table of unary function over half-precision values.
+	/// Since there are only 65536 half-precision values, any unary function from half to half can be tabulated in a table 
+	/// of 128 KiB, which turns each evaluation into a single table lookup instead of conversions to and from 
+	/// single-precision and a call to the C++ standard library.
+	class function_table
+	{
+	public:
+		/// Tabulate function.
+		/// The function is called once for each half-precision value converted to `double` and its results are rounded 
+		/// to half-precision like half_cast() would. So the table is correctly rounded as long as the function is accurate 
+		/// in double-precision, which makes it even more accurate than most mathematical functions of the library itself.
+		/// \tparam F type of function
+		/// \param f function to tabulate, callable with a `double` and returning any type half_cast() can convert from
+		/// \param round rounding mode to use for results
+		template<typename F> explicit function_table(F f, std::float_round_style round = (std::float_round_style)(HALF_ROUND_STYLE))
+			: table_(65536)
+		{
+			switch(round)
+			{
+				case std::round_toward_zero: build<std::round_toward_zero>(f); break;
+				case std::round_to_nearest: build<std::round_to_nearest>(f); break;
+				case std::round_toward_infinity: build<std::round_toward_infinity>(f); break;
+				case std::round_toward_neg_infinity: build<std::round_toward_neg_infinity>(f); break;
+				default: build<std::round_indeterminate>(f);
+			}
+		}
+
+		/// Evaluate function.
+		/// \param arg function argument
+		/// \return tabulated function value
+		half operator()(half arg) const { return half(detail::binary, table_[arg.data_]); }
+
+		/// Evaluate function for array.
+		/// \param src array of function arguments
+		/// \param dst array to store function values into, may be the same as \a src
+		/// \param n number of values
+		void operator()(const half *src, half *dst, std::size_t n) const
+		{
+			const detail::uint16 *table = &table_[0];
+			for(std::size_t i=0; i<n; ++i)
+				dst[i].data_ = table[src[i].data_];
+		}
+
+	private:
+		/// Fill table.
+		/// \tparam R rounding mode to use
+		/// \tparam F type of function
+		/// \param f function to tabulate
+		template<std::float_round_style R,typename F> void build(F &f)
+		{
+			for(unsigned int i=0; i<65536; ++i)
+				table_[i] = round<R>(f(detail::half2float<double>(static_cast<detail::uint16>(i))));
+		}
+
+		/// Round function value to half-precision.
+		/// \tparam R rounding mode to use
+		/// \tparam T type of function value
+		/// \param value function value
+		/// \return binary representation of half-precision value
+		template<std::float_round_style R,typename T> static detail::uint16 round(T value) { return detail::half_cast<half,R>(value).data_; }
+
+		/// Function values.
+		std::vector<detail::uint16> table_;
+	};
+
+	/// Access lazily built lookup table of function.
+	/// The table is built on the first call for a function, which is thread-safe if the compiler initializes function-local 
+	/// statics thread-safely (as required by C++11), and shared by all later calls.
+	/// \tparam F function to tabulate
+	/// \return lookup table of \a F
+	template<double(*F)(double)> const function_table& tabulated()
+	{
+		static const function_table table(F);
+		return table;
 	}
 
+	/// Evaluate function using lazily built lookup table.
+	/// This evaluates \a F exactly like a function_table would, building the table on first use. Functions from the C++ 
+	/// standard library can be given directly, e.g. `tabulate<std::erf>(x)`.
+	/// \tparam F function to tabulate
+	/// \param arg function argument
+	/// \return tabulated function value
+	template<double(*F)(double)> half tabulate(half arg) { return tabulated<F>()(arg); }
+
+	/// Evaluate function for array using lazily built lookup table.
+	/// \tparam F function to tabulate
+	/// \param src array of function arguments
+	/// \param dst array to store function values into, may be the same as \a src
+	/// \param n number of values
+	template<double(*F)(double)> void tabulate(const half *src, half *dst, std::size_t n) { tabulated<F>()(src, dst, n); }
+
+	/// Read-only view of a half-precision array for array expressions.
+	/// This doesn't own the data, it just refers to an existing array, so it is cheap to copy and has to be outlived by 
+	/// the array. It can be used as operand of the [array expression operators](\ref half_float::half_span).
+	class const_half_span : public detail::array_expr<const_half_span>
+	{
+	public:
+		/// Constructor.
+		/// \param data pointer to first element
+		/// \param size number of elements
+		const_half_span(const half *data, std::size_t size) : data_(data), size_(size) {}
+
+		/// Construct view of vector.
+		/// \param data vector to refer to
+		const_half_span(const std::vector<half> &data) : data_(data.empty() ? NULL : &data[0]), size_(data.size()) {}
+
+		/// Pointer to first element.
+		/// \return pointer to data
+		const half* data() const { return data_; }
+
+		/// Number of elements.
+		/// \return number of elements
+		std::size_t size() const { return size_; }
+
+		/// Access element.
+		/// \param i index of element
+		/// \return element
+		const half& operator[](std::size_t i) const { return data_[i]; }
+
+		/// Evaluate elements.
+		/// \param i index of first element to evaluate
+		/// \param n number of elements to evaluate
+		/// \param out array to store elements into
+		void eval(std::size_t i, std::size_t n, float *out) const { detail::bulk::half2float(data_+i, out, n); }
+
+	private:
+		/// Pointer to data.
+		const half *data_;
+
+		/// Number of elements.
+		std::size_t size_;
+	};
+
+	/// View of a half-precision array for array expressions.
+	/// This doesn't own the data, it just refers to an existing array, so it is cheap to copy and has to be outlived by 
+	/// the array. Arithmetic operators and the functions abs() and sqrt() on spans don't compute anything, but build lazy 
+	/// expressions, that are only evaluated when assigned to a span:
+	///
+	/// ~~~~{.cpp}
+	/// half_span y(out, n);
+	/// y = a*const_half_span(x, n) + b*const_half_span(z, n);
+	/// ~~~~
+	///
+	/// This computes the whole expression in a single pass over the arrays, converting blocks of the operands to 
+	/// single-precision with SIMD instructions and rounding each result to half-precision only once, without any temporary 
+	/// arrays. So results are exactly the same as computing `y[i] = a*x[i] + b*z[i]` with halfs, where intermediate results 
+	/// are kept in single-precision as well. The destination may be one of the operands, but must not partially overlap 
+	/// any of them. If the sizes of the operands differ, only the elements present in all of them are computed and 
+	/// destination elements beyond that are left unchanged.
+	class half_span : public detail::array_expr<half_span>
+	{
+	public:
+		/// Constructor.
+		/// \param data pointer to first element
+		/// \param size number of elements
+		half_span(half *data, std::size_t size) : data_(data), size_(size) {}
+
+		/// Construct view of vector.
+		/// \param data vector to refer to
+		half_span(std::vector<half> &data) : data_(data.empty() ? NULL : &data[0]), size_(data.size()) {}
+
+		/// Copy constructor.
+		/// Unlike the assignment, this doesn't copy any elements, but creates another view of the same array.
+		/// \param rhs span to refer to the array of
+		half_span(const half_span &rhs) : data_(rhs.data_), size_(rhs.size_) {}
+
+		/// Assign elements of other span.
+		/// Like any assignment to a span, this changes the elements and not the array referred to.
+		/// \param rhs span to copy elements from
+		/// \return reference to this span
+		half_span& operator=(const half_span &rhs) { return *this = const_half_span(rhs); }
+
+		/// Assign elements of read-only span.
+		/// \param rhs span to copy elements from
+		/// \return reference to this span
+		half_span& operator=(const const_half_span &rhs)
+		{
+			if(rhs.data() != data_)
+				std::copy(rhs.data(), rhs.data()+std::min(size_, rhs.size()), data_);
+			return *this;
+		}
+
+		/// Assign array expression.
+		/// \tparam E type of expression
+		/// \param rhs expression to evaluate
+		/// \return reference to this span
+		template<typename E> half_span& operator=(const detail::array_expr<E> &rhs)
+		{
+			detail::array_assign<(std::float_round_style)(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(rhs.self(), data_, std::min(size_, rhs.self().size()));
+			return *this;
+		}
+
+		/// Assign scalar to all elements.
+		/// \param rhs value to assign
+		/// \return reference to this span
+		half_span& operator=(half rhs) { std::fill(data_, data_+size_, rhs); return *this; }
+
+		/// Assign single-precision scalar to all elements.
+		/// \param rhs value to round to half-precision and assign
+		/// \return reference to this span
+		half_span& operator=(float rhs) { return *this = half(rhs); }
+
+		/// Add array expression.
+		/// \tparam E type of expression
+		/// \param rhs expression to add
+		/// \return reference to this span
+		template<typename E> half_span& operator+=(const detail::array_expr<E> &rhs) { return *this = *this + rhs; }
+
+		/// Subtract array expression.
+		/// \tparam E type of expression
+		/// \param rhs expression to subtract
+		/// \return reference to this span
+		template<typename E> half_span& operator-=(const detail::array_expr<E> &rhs) { return *this = *this - rhs; }
+
+		/// Multiply by array expression.
+		/// \tparam E type of expression
+		/// \param rhs expression to multiply by
+		/// \return reference to this span
+		template<typename E> half_span& operator*=(const detail::array_expr<E> &rhs) { return *this = *this * rhs; }
+
+		/// Divide by array expression.
+		/// \tparam E type of expression
+		/// \param rhs expression to divide by
+		/// \return reference to this span
+		template<typename E> half_span& operator/=(const detail::array_expr<E> &rhs) { return *this = *this / rhs; }
+
+		/// Add scalar.
+		/// \param rhs value to add
+		/// \return reference to this span
+		half_span& operator+=(float rhs) { return *this = *this + rhs; }
+
+		/// Subtract scalar.
+		/// \param rhs value to subtract
+		/// \return reference to this span
+		half_span& operator-=(float rhs) { return *this = *this - rhs; }
+
+		/// Multiply by scalar.
+		/// \param rhs value to multiply by
+		/// \return reference to this span
+		half_span& operator*=(float rhs) { return *this = *this * rhs; }
+
+		/// Divide by scalar.
+		/// \param rhs value to divide by
+		/// \return reference to this span
+		half_span& operator/=(float rhs) { return *this = *this / rhs; }
+
+		/// Pointer to first element.
+		/// \return pointer to data
+		half* data() const { return data_; }
+
+		/// Number of elements.
+		/// \return number of elements
+		std::size_t size() const { return size_; }
+
+		/// Access element.
+		/// \param i index of element
+		/// \return reference to element
+		half& operator[](std::size_t i) const { return data_[i]; }
+
+		/// Conversion to read-only span.
+		/// \return read-only span of same array
+		operator const_half_span() const { return const_half_span(data_, size_); }
+
+		/// Evaluate elements.
+		/// \param i index of first element to evaluate
+		/// \param n number of elements to evaluate
+		/// \param out array to store elements into
+		void eval(std::size_t i, std::size_t n, float *out) const { detail::bulk::half2float(data_+i, out, n); }
+
+	private:
+		/// Pointer to data.
+		half *data_;
+
+		/// Number of elements.
+		std::size_t size_;
+	};
+
 	using detail::operator==;
 	using detail::operator!=;
 	using detail::operator<;
@@ -2941,6 +9300,56 @@ namespace half_float
 	using detail::isunordered;
 
 	using detail::half_cast;
+	using detail::saturate_cast;
+	using detail::stochastic_cast;
+	using detail::convert;
+	using detail::convert_parallel;
+	using detail::convert_strided;
+	using detail::convert_gather;
+	using detail::convert_scatter;
+	using detail::convert_deinterleave;
+	using detail::convert_interleave;
+	using detail::convert_inplace;
+	using detail::convert_int;
+	using detail::sigmoid;
+	using detail::negate;
+	using detail::clamp;
+	using detail::relu;
+	using detail::dot;
+	using detail::axpy;
+	using detail::gemv;
+	using detail::gemm;
+	using detail::sum;
+	using detail::mean;
+	using detail::variance;
+	using detail::nrm2;
+	using detail::minimum;
+	using detail::maximum;
+	using detail::argmin;
+	using detail::argmax;
+	using detail::sum_parallel;
+	using detail::mean_parallel;
+	using detail::variance_parallel;
+	using detail::nrm2_parallel;
+	using detail::minimum_parallel;
+	using detail::maximum_parallel;
+	using detail::argmin_parallel;
+	using detail::argmax_parallel;
+	using detail::exact_accumulator;
+	using detail::exact_sum;
+	using detail::exact_dot;
+	using detail::exact_sum_parallel;
+	using detail::exact_dot_parallel;
+	using detail::sort;
+	using detail::argsort;
+	using detail::partial_sort;
+	using detail::top_k;
+	using detail::half_histogram;
+#if HALF_ENABLE_FLOAT16
+	using detail::native_cast;
+#endif
+	using detail::set_parallel_threads;
+	using detail::set_streaming_threshold;
 }
 
 
@@ -3060,6 +9469,9 @@ namespace std
 #undef HALF_CONSTEXPR_CONST
 #undef HALF_NOEXCEPT
 #undef HALF_NOTHROW
+#undef HALF_TARGET
+#undef HALF_NATIVE_CONVERSION
+#undef HALF_NATIVE_ARITHMETIC
 #ifdef HALF_POP_WARNINGS
 	#pragma warning(pop)
 	#undef HALF_POP_WARNINGS
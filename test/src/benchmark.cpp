@@ -0,0 +1,190 @@
+// benchmark - Benchmark application for half-precision floating point functionality.
+//
+// Copyright (c) 2012-2017 Christian Rau <rauy@users.sourceforge.net>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <half.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <functional>
+#include <random>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+
+using half_float::half;
+using half_float::half_cast;
+
+
+class half_benchmark
+{
+public:
+	half_benchmark(std::size_t size)
+		: halfs_(size), floats_(size), polluter_(1<<20), half_out_(size), float_out_(size)
+	{
+		auto rand16 = std::bind(std::uniform_int_distribution<std::uint16_t>(0, 0xFFFF), std::default_random_engine());
+		auto randf = std::bind(std::uniform_real_distribution<float>(-70000.0f, 70000.0f), std::default_random_engine());
+		for(std::size_t i=0; i<size; ++i)
+		{
+			std::uint16_t bits = rand16();
+			if((bits&0x7C00) == 0x7C00)
+				bits ^= 0x4000;
+			std::memcpy(static_cast<void*>(&halfs_[i]), &bits, sizeof(half));
+			floats_[i] = randf();
+		}
+	}
+
+	void run()
+	{
+		std::cout << "conversion strategy " << HALF_CONVERSION_STRATEGY << ":\n";
+
+		//throughput with random values, tables stay in cache
+		measure("half to float, random", [this]() { float sum = 0.0f; for(half h : halfs_) sum += half_cast<float>(h); return sum; });
+		measure("float to half, random", [this]() { float sum = 0.0f; for(float f : floats_) sum += half_cast<float>(half_cast<half>(f)); return sum; });
+
+		//latency of dependent conversions
+		measure("half to float, dependent", [this]() { half h = halfs_.front(); for(std::size_t i=0; i<halfs_.size(); ++i)
+			{ h = half_cast<half>(half_cast<float>(h)*0.999f+0.5f); } return half_cast<float>(h); });
+
+		//throughput with other data competing for the cache
+		measure("half to float, cache pressure", [this]() { float sum = 0.0f; std::size_t j = 0; for(half h : halfs_)
+			{ sum += half_cast<float>(h) + polluter_[j]; j = (j+4099) & (polluter_.size()-1); } return sum; });
+
+		//memory bandwidth of bulk conversions with regular and streaming stores
+		std::size_t n = halfs_.size(), bytes = n * (sizeof(float)+sizeof(half));
+		for(int stream=0; stream<2; ++stream)
+		{
+			half_float::set_streaming_threshold(stream ? 0 : std::numeric_limits<std::size_t>::max());
+			std::string mode = stream ? ", streaming" : ", cached";
+			bandwidth("convert float to half"+mode, bytes, [this,n]() { half_float::convert(floats_.data(), half_out_.data(), n); });
+			bandwidth("convert half to float"+mode, bytes, [this,n]() { half_float::convert(halfs_.data(), float_out_.data(), n); });
+			bandwidth("convert_parallel float to half"+mode, bytes, [this,n]() { half_float::convert_parallel(floats_.data(), half_out_.data(), n); });
+			bandwidth("convert_parallel half to float"+mode, bytes, [this,n]() { half_float::convert_parallel(halfs_.data(), float_out_.data(), n); });
+		}
+		half_float::set_streaming_threshold(HALF_STREAMING_THRESHOLD);
+
+		//matrix multiplication compared to cache-blocked single-precision multiplication with the same register blocks
+		std::size_t dim = 512;
+		while(2*dim*dim > halfs_.size())
+			dim /= 2;
+		std::vector<float> a(dim*dim), b(dim*dim), c(dim*dim);
+		half_float::convert(halfs_.data(), a.data(), dim*dim);
+		half_float::convert(halfs_.data()+dim*dim, b.data(), dim*dim);
+		half_float::set_parallel_threads(1);
+		gflops("gemm, 1 thread", 2.0*dim*dim*dim, [this,dim]() { half_float::gemm(dim, dim, dim, 1.0f, halfs_.data(), dim, 
+			halfs_.data()+dim*dim, dim, 0.0f, half_out_.data(), dim); });
+		gflops("blocked float gemm, 1 thread", 2.0*dim*dim*dim, [&,dim]() { float_gemm(dim, a.data(), b.data(), c.data()); });
+		half_float::set_parallel_threads(0);
+		gflops("gemm", 2.0*dim*dim*dim, [this,dim]() { half_float::gemm(dim, dim, dim, 1.0f, halfs_.data(), dim, 
+			halfs_.data()+dim*dim, dim, 0.0f, half_out_.data(), dim); });
+		std::cout << '\n';
+	}
+
+private:
+	template<typename F> void measure(const std::string &name, F f)
+	{
+		volatile float sink = f();
+		auto start = std::chrono::high_resolution_clock::now();
+		for(unsigned int i=0; i<10; ++i)
+			sink = f();
+		double ns = std::chrono::duration_cast<std::chrono::duration<double,std::nano>>(std::chrono::high_resolution_clock::now()-start).count();
+		std::cout << std::setw(40) << std::left << name << std::setw(8) << std::right << std::fixed << std::setprecision(3)
+			<< (ns/(10.0*halfs_.size())) << " ns\n";
+		static_cast<void>(sink);
+	}
+
+	template<typename F> void bandwidth(const std::string &name, std::size_t bytes, F f)
+	{
+		f();
+		auto start = std::chrono::high_resolution_clock::now();
+		for(unsigned int i=0; i<10; ++i)
+			f();
+		double ns = std::chrono::duration_cast<std::chrono::duration<double,std::nano>>(std::chrono::high_resolution_clock::now()-start).count();
+		std::cout << std::setw(40) << std::left << name << std::setw(8) << std::right << std::fixed << std::setprecision(3)
+			<< (10.0*bytes/ns) << " GB/s\n";
+	}
+
+	static void float_gemm(std::size_t dim, const float *a, const float *b, float *c)
+	{
+	#if HALF_ENABLE_F16C_INTRINSICS
+		if(half_float::detail::cpu_supports(half_float::detail::cpu_f16c))
+			return float_gemm<half_float::detail::gemm_kernel_avx>(dim, a, b, c);
+	#endif
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		float_gemm<half_float::detail::gemm_kernel_sse2>(dim, a, b, c);
+	#else
+		float_gemm<half_float::detail::gemm_kernel>(dim, a, b, c);
+	#endif
+	}
+
+	template<typename K> static void float_gemm(std::size_t dim, const float *a, const float *b, float *c)
+	{
+		const std::size_t mc = 72, kc = 256, np = (dim+K::nr-1) / K::nr * K::nr;
+		std::vector<float> panels(np*kc), packed(mc*kc), sums(mc*np);
+		std::fill(c, c+dim*dim, 0.0f);
+		for(std::size_t pc=0; pc<dim; pc+=kc)
+		{
+			std::size_t depth = std::min(dim-pc, kc);
+			std::fill(panels.begin(), panels.end(), 0.0f);
+			for(std::size_t p=0; p<depth; ++p)
+				for(std::size_t j=0; j<dim; ++j)
+					panels[(j/K::nr)*K::nr*depth+p*K::nr+j%K::nr] = b[(pc+p)*dim+j];
+			for(std::size_t ic=0; ic<dim; ic+=mc)
+			{
+				std::size_t rows = std::min(dim-ic, mc), mp = (rows+K::mr-1) / K::mr * K::mr;
+				for(std::size_t i=0; i<mp; ++i)
+					for(std::size_t p=0; p<depth; ++p)
+						packed[(i/K::mr)*K::mr*depth+p*K::mr+i%K::mr] = (i < rows) ? a[(ic+i)*dim+pc+p] : 0.0f;
+				std::fill(sums.begin(), sums.end(), 0.0f);
+				for(std::size_t jr=0; jr<np; jr+=K::nr)
+					for(std::size_t ir=0; ir<mp; ir+=K::mr)
+						K::run(depth, &packed[ir*depth], &panels[jr*depth], &sums[ir*np+jr], np);
+				for(std::size_t i=0; i<rows; ++i)
+					for(std::size_t j=0; j<dim; ++j)
+						c[(ic+i)*dim+j] += sums[i*np+j];
+			}
+		}
+	}
+
+	template<typename F> void gflops(const std::string &name, double flops, F f)
+	{
+		f();
+		auto start = std::chrono::high_resolution_clock::now();
+		for(unsigned int i=0; i<10; ++i)
+			f();
+		double ns = std::chrono::duration_cast<std::chrono::duration<double,std::nano>>(std::chrono::high_resolution_clock::now()-start).count();
+		std::cout << std::setw(40) << std::left << name << std::setw(8) << std::right << std::fixed << std::setprecision(3)
+			<< (10.0*flops/ns) << " GFLOPS\n";
+	}
+
+	std::vector<half> halfs_;
+	std::vector<float> floats_;
+	std::vector<float> polluter_;
+	std::vector<half> half_out_;
+	std::vector<float> float_out_;
+};
+
+
+int main(int argc, char *argv[])
+{
+	half_benchmark benchmark((argc > 1) ? std::stoul(argv[1]) : (1<<24));
+	benchmark.run();
+	return 0;
+}
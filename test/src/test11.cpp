@@ -35,6 +35,9 @@
 #include <typeinfo>
 #include <cstdint>
 #include <cmath>
+#include <cstring>
+#include <thread>
+#include <atomic>
 #if HALF_ENABLE_CPP11_HASH
 	#include <unordered_map>
 #endif
@@ -56,6 +59,31 @@
 		err = std::max(err, error); rel = std::max(rel, error/std::min(std::abs(static_cast<double>(x)), std::abs(static_cast<double>(y)))); } return equal; }); \
 	if(err != 0.0 || rel != 0.0) std::cout << #func << " max error: " << err << " - max relative error: " << rel << '\n'; }
 
+#define BULK_CONVERSION_TEST(name, round, ...) \
+	simple_test(name, [this]() { return bulk_conversion_test<round,HALF_ROUND_TIES_TO_EVEN>(floats_, [](const float *src, half *dst, std::size_t n) { __VA_ARGS__(src, dst, n); }); })
+
+#define BULK_DOUBLE_CONVERSION_TEST(name, round, ...) \
+	simple_test(name, [this]() { return bulk_conversion_test<round,HALF_ROUND_TIES_TO_EVEN>(doubles_, [](const double *src, half *dst, std::size_t n) { __VA_ARGS__(src, dst, n); }); })
+
+#define BULK_TIES_CONVERSION_TEST(name, ties, type, values, ...) \
+	simple_test(name, [this]() { return bulk_conversion_test<std::round_to_nearest,ties>(values, [](const type *src, half *dst, std::size_t n) { __VA_ARGS__(src, dst, n); }); })
+
+#define BULK_SATURATING_CONVERSION_TEST(name, round, type, values, ...) \
+	simple_test(name, [this]() { return bulk_saturating_conversion_test<round>(values, [](const type *src, half *dst, std::size_t n) { __VA_ARGS__(src, dst, n); }); })
+
+#define LONG_DOUBLE_CONVERSION_TEST(name, round) \
+	simple_test(name, [this]() { return long_double_conversion_test<round>(); })
+
+#define ARRAY_MATH_TEST(func, ...) \
+	simple_test(#func " array", [this]() { return array_math_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE)>( \
+		[](const half *src, half *dst, std::size_t n) { half_float::func(src, dst, n); }, __VA_ARGS__); })
+
+#define ARRAY_MATH_ROUNDING_TEST(func, ...) \
+	simple_test(#func " array rounding", [this]() { return \
+		array_math_test<std::round_toward_zero>(half_float::detail::bulk::math<half_float::detail::math_##func,std::round_toward_zero,HALF_ROUND_TIES_TO_EVEN>, __VA_ARGS__) && \
+		array_math_test<std::round_toward_infinity>(half_float::detail::bulk::math<half_float::detail::math_##func,std::round_toward_infinity,HALF_ROUND_TIES_TO_EVEN>, __VA_ARGS__) && \
+		array_math_test<std::round_toward_neg_infinity>(half_float::detail::bulk::math<half_float::detail::math_##func,std::round_toward_neg_infinity,HALF_ROUND_TIES_TO_EVEN>, __VA_ARGS__); })
+
 
 using half_float::half;
 using half_float::half_cast;
@@ -82,6 +110,52 @@ public:
 	half_test(std::ostream &log, bool fast)
 		: tests_(0), log_(log), fast_(fast)
 	{
+		//prepare floats around all halfs and at random
+		auto rand32 = std::bind(std::uniform_int_distribution<std::uint32_t>(0, std::numeric_limits<std::uint32_t>::max()), std::default_random_engine());
+		for(std::uint32_t u=0; u<0x10000; ++u)
+		{
+			float f = half_cast<float>(b2h(u));
+			std::uint32_t bits;
+			std::memcpy(&bits, &f, sizeof(float));
+			for(std::uint32_t offset : { 0x0u, 0x1u, 0xFFFu, 0x1000u, 0x1001u, 0xFFFFFFFFu })
+			{
+				std::uint32_t neighbour = bits + offset;
+				std::memcpy(&f, &neighbour, sizeof(float));
+				floats_.push_back(f);
+			}
+		}
+		for(unsigned int i=(fast_ ? (1<<20) : (1<<24))+7; i>0; --i)
+		{
+			std::uint32_t bits = rand32();
+			float f;
+			std::memcpy(&f, &bits, sizeof(float));
+			floats_.push_back(f);
+		}
+
+		//prepare doubles around all halfs and at random
+		auto rand64 = std::bind(std::uniform_int_distribution<std::uint64_t>(0, std::numeric_limits<std::uint64_t>::max()), std::default_random_engine());
+		for(std::uint32_t u=0; u<0x10000; ++u)
+		{
+			double d = half_cast<double>(b2h(u));
+			std::uint64_t bits;
+			std::memcpy(&bits, &d, sizeof(double));
+			for(std::uint64_t offset : { 0x0ull, 0x1ull, 0x1FFFFFFFFFFull, 0x20000000000ull, 0x20000000001ull, 0xFFFFFFFFFFFFFFFFull })
+			{
+				std::uint64_t neighbour = bits + offset;
+				std::memcpy(&d, &neighbour, sizeof(double));
+				doubles_.push_back(d);
+			}
+		}
+		for(unsigned int i=(fast_ ? (1<<18) : (1<<22))+7; i>0; --i)
+		{
+			std::uint64_t bits = rand64();
+			if(i & 1)
+				bits = (bits&0x800FFFFFFFFFFFFFull) | ((0x3D0+(bits>>52)%0x60)<<52);
+			double d;
+			std::memcpy(&d, &bits, sizeof(double));
+			doubles_.push_back(d);
+		}
+
 		//prepare halfs
 		half_vector batch;
 		std::uint16_t u = 0;
@@ -159,6 +233,9 @@ public:
 		binary_test("subtraction", [](half a, half b) { return comp(a-b, static_cast<half>(static_cast<double>(a)-static_cast<double>(b))); });
 		binary_test("multiplication", [](half a, half b) { return comp(a*b, static_cast<half>(static_cast<double>(a)*static_cast<double>(b))); });
 		binary_test("division", [](half a, half b) { return comp(a/b, static_cast<half>(static_cast<double>(a)/static_cast<double>(b))); });
+		binary_test("assignment operators", [](half a, half b) -> bool { half c = a, d = a, e = a, f = a; c += b; d -= b; e *= b; f /= b;
+			return comp(c, static_cast<half>(static_cast<double>(a)+static_cast<double>(b))) && comp(d, static_cast<half>(static_cast<double>(a)-static_cast<double>(b))) && 
+				comp(e, static_cast<half>(static_cast<double>(a)*static_cast<double>(b))) && comp(f, static_cast<half>(static_cast<double>(a)/static_cast<double>(b))); });
 		binary_test("equal", [](half a, half b) { return (a==b) == (static_cast<double>(a)==static_cast<double>(b)); });
 		binary_test("not equal", [](half a, half b) { return (a!=b) == (static_cast<double>(a)!=static_cast<double>(b)); });
 		binary_test("less", [](half a, half b) { return (a<b) == (static_cast<double>(a)<static_cast<double>(b)); });
@@ -384,6 +461,218 @@ public:
 			*reinterpret_cast<std::uint64_t*>(&f) |= n&(m-1)&-isfinite(arg); return comp(half_cast<half,std::round_toward_neg_infinity>(f), 
 			(signbit(arg)&&(n&(m-1))) ? nextafter(arg, copysign(std::numeric_limits<half>::infinity(), arg)) : arg); });
 
+		//test conversion table generation
+		simple_test("half2float_bits", [this]() { for(std::uint32_t u=0; u<0x10000; ++u) { float f = half_cast<float>(b2h(u)); std::uint32_t bits;
+			std::memcpy(&bits, &f, sizeof(float)); if(half_float::detail::half2float_bits(u) != bits) return false; } return true; });
+
+		//test bulk conversion
+		BULK_CONVERSION_TEST("convert(float)", static_cast<std::float_round_style>(HALF_ROUND_STYLE), half_float::convert);
+		BULK_CONVERSION_TEST("convert<round_indeterminate>(float)", std::round_indeterminate, half_float::convert<std::round_indeterminate>);
+		BULK_CONVERSION_TEST("convert<round_toward_zero>(float)", std::round_toward_zero, half_float::convert<std::round_toward_zero>);
+		BULK_CONVERSION_TEST("convert<round_to_nearest>(float)", std::round_to_nearest, half_float::convert<std::round_to_nearest>);
+		BULK_CONVERSION_TEST("convert<round_toward_infinity>(float)", std::round_toward_infinity, half_float::convert<std::round_toward_infinity>);
+		BULK_CONVERSION_TEST("convert<round_toward_neg_infinity>(float)", std::round_toward_neg_infinity, half_float::convert<std::round_toward_neg_infinity>);
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		BULK_CONVERSION_TEST("SSE2 float2half<round_indeterminate>", std::round_indeterminate, half_float::detail::bulk::float2half_sse2<std::round_indeterminate,HALF_ROUND_TIES_TO_EVEN,false>);
+		BULK_CONVERSION_TEST("SSE2 float2half<round_toward_zero>", std::round_toward_zero, half_float::detail::bulk::float2half_sse2<std::round_toward_zero,HALF_ROUND_TIES_TO_EVEN,false>);
+		BULK_CONVERSION_TEST("SSE2 float2half<round_to_nearest>", std::round_to_nearest, half_float::detail::bulk::float2half_sse2<std::round_to_nearest,HALF_ROUND_TIES_TO_EVEN,false>);
+		BULK_CONVERSION_TEST("SSE2 float2half<round_toward_infinity>", std::round_toward_infinity, half_float::detail::bulk::float2half_sse2<std::round_toward_infinity,HALF_ROUND_TIES_TO_EVEN,false>);
+		BULK_CONVERSION_TEST("SSE2 float2half<round_toward_neg_infinity>", std::round_toward_neg_infinity, half_float::detail::bulk::float2half_sse2<std::round_toward_neg_infinity,HALF_ROUND_TIES_TO_EVEN,false>);
+	#endif
+		BULK_TIES_CONVERSION_TEST("convert<round_to_nearest,true>(float)", true, float, floats_, half_float::convert<std::round_to_nearest,true>);
+		BULK_TIES_CONVERSION_TEST("convert<round_to_nearest,false>(float)", false, float, floats_, half_float::convert<std::round_to_nearest,false>);
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		BULK_TIES_CONVERSION_TEST("SSE2 float2half<round_to_nearest,true>", true, float, floats_, half_float::detail::bulk::float2half_sse2<std::round_to_nearest,true,false>);
+		BULK_TIES_CONVERSION_TEST("SSE2 float2half<round_to_nearest,false>", false, float, floats_, half_float::detail::bulk::float2half_sse2<std::round_to_nearest,false,false>);
+	#endif
+	#if HALF_ENABLE_F16C_INTRINSICS
+		if(half_float::detail::cpu_supports(half_float::detail::cpu_avx2))
+		{
+			BULK_TIES_CONVERSION_TEST("AVX2 float2half<round_to_nearest,true>", true, float, floats_, half_float::detail::bulk::float2half_avx2<std::round_to_nearest,true,false>);
+			BULK_TIES_CONVERSION_TEST("AVX2 float2half<round_to_nearest,false>", false, float, floats_, half_float::detail::bulk::float2half_avx2<std::round_to_nearest,false,false>);
+			BULK_CONVERSION_TEST("AVX2 float2half<round_indeterminate>", std::round_indeterminate, half_float::detail::bulk::float2half_avx2<std::round_indeterminate,HALF_ROUND_TIES_TO_EVEN,false>);
+			BULK_CONVERSION_TEST("AVX2 float2half<round_toward_zero>", std::round_toward_zero, half_float::detail::bulk::float2half_avx2<std::round_toward_zero,HALF_ROUND_TIES_TO_EVEN,false>);
+			BULK_CONVERSION_TEST("AVX2 float2half<round_toward_infinity>", std::round_toward_infinity, half_float::detail::bulk::float2half_avx2<std::round_toward_infinity,HALF_ROUND_TIES_TO_EVEN,false>);
+			BULK_CONVERSION_TEST("AVX2 float2half<round_toward_neg_infinity>", std::round_toward_neg_infinity, half_float::detail::bulk::float2half_avx2<std::round_toward_neg_infinity,HALF_ROUND_TIES_TO_EVEN,false>);
+		}
+	#endif
+		simple_test("convert(half)", [this]() { return bulk_conversion_test<float>([](const half *src, float *dst, std::size_t n) { half_float::convert(src, dst, n); }); });
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		simple_test("SSE2 half2float", [this]() { return bulk_conversion_test<float>([](const half *src, float *dst, std::size_t n) { half_float::detail::bulk::half2float_sse2(src, dst, n); }); });
+	#endif
+		BULK_DOUBLE_CONVERSION_TEST("convert(double)", static_cast<std::float_round_style>(HALF_ROUND_STYLE), half_float::convert);
+		BULK_DOUBLE_CONVERSION_TEST("convert<round_indeterminate>(double)", std::round_indeterminate, half_float::convert<std::round_indeterminate>);
+		BULK_DOUBLE_CONVERSION_TEST("convert<round_toward_zero>(double)", std::round_toward_zero, half_float::convert<std::round_toward_zero>);
+		BULK_DOUBLE_CONVERSION_TEST("convert<round_to_nearest>(double)", std::round_to_nearest, half_float::convert<std::round_to_nearest>);
+		BULK_DOUBLE_CONVERSION_TEST("convert<round_toward_infinity>(double)", std::round_toward_infinity, half_float::convert<std::round_toward_infinity>);
+		BULK_DOUBLE_CONVERSION_TEST("convert<round_toward_neg_infinity>(double)", std::round_toward_neg_infinity, half_float::convert<std::round_toward_neg_infinity>);
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		BULK_DOUBLE_CONVERSION_TEST("SSE2 double2half<round_indeterminate>", std::round_indeterminate, half_float::detail::bulk::double2half_sse2<std::round_indeterminate,HALF_ROUND_TIES_TO_EVEN,false>);
+		BULK_DOUBLE_CONVERSION_TEST("SSE2 double2half<round_to_nearest>", std::round_to_nearest, half_float::detail::bulk::double2half_sse2<std::round_to_nearest,HALF_ROUND_TIES_TO_EVEN,false>);
+		BULK_DOUBLE_CONVERSION_TEST("SSE2 double2half<round_toward_neg_infinity>", std::round_toward_neg_infinity, half_float::detail::bulk::double2half_sse2<std::round_toward_neg_infinity,HALF_ROUND_TIES_TO_EVEN,false>);
+	#endif
+		BULK_TIES_CONVERSION_TEST("convert<round_to_nearest,true>(double)", true, double, doubles_, half_float::convert<std::round_to_nearest,true>);
+		BULK_TIES_CONVERSION_TEST("convert<round_to_nearest,false>(double)", false, double, doubles_, half_float::convert<std::round_to_nearest,false>);
+		BULK_SATURATING_CONVERSION_TEST("convert<round_indeterminate,true,true>(float)", std::round_indeterminate, float, floats_, half_float::convert<std::round_indeterminate,true,true>);
+		BULK_SATURATING_CONVERSION_TEST("convert<round_toward_zero,true,true>(float)", std::round_toward_zero, float, floats_, half_float::convert<std::round_toward_zero,true,true>);
+		BULK_SATURATING_CONVERSION_TEST("convert<round_to_nearest,true,true>(float)", std::round_to_nearest, float, floats_, half_float::convert<std::round_to_nearest,true,true>);
+		BULK_SATURATING_CONVERSION_TEST("convert<round_toward_infinity,true,true>(float)", std::round_toward_infinity, float, floats_, half_float::convert<std::round_toward_infinity,true,true>);
+		BULK_SATURATING_CONVERSION_TEST("convert<round_toward_neg_infinity,true,true>(float)", std::round_toward_neg_infinity, float, floats_, half_float::convert<std::round_toward_neg_infinity,true,true>);
+		BULK_SATURATING_CONVERSION_TEST("convert<round_to_nearest,true,true>(double)", std::round_to_nearest, double, doubles_, half_float::convert<std::round_to_nearest,true,true>);
+		BULK_SATURATING_CONVERSION_TEST("convert<round_toward_infinity,true,true>(double)", std::round_toward_infinity, double, doubles_, half_float::convert<std::round_toward_infinity,true,true>);
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		BULK_SATURATING_CONVERSION_TEST("SSE2 float2half<round_to_nearest,true,true>", std::round_to_nearest, float, floats_, half_float::detail::bulk::float2half_sse2<std::round_to_nearest,true,true>);
+		BULK_SATURATING_CONVERSION_TEST("SSE2 double2half<round_indeterminate,true,true>", std::round_indeterminate, double, doubles_, half_float::detail::bulk::double2half_sse2<std::round_indeterminate,true,true>);
+	#endif
+	#if HALF_ENABLE_F16C_INTRINSICS
+		if(half_float::detail::cpu_supports(half_float::detail::cpu_avx2))
+			BULK_SATURATING_CONVERSION_TEST("AVX2 float2half<round_toward_infinity,true,true>", std::round_toward_infinity, float, floats_, half_float::detail::bulk::float2half_avx2<std::round_toward_infinity,true,true>);
+		if(half_float::detail::cpu_supports(half_float::detail::cpu_f16c))
+			BULK_SATURATING_CONVERSION_TEST("F16C float2half<round_indeterminate,true,true>", std::round_indeterminate, float, floats_, half_float::detail::bulk::float2half_f16c<std::round_indeterminate,true,true>);
+	#endif
+		BULK_SATURATING_CONVERSION_TEST("saturate_cast(float)", static_cast<std::float_round_style>(HALF_ROUND_STYLE), float, floats_,
+			[](const float *src, half *dst, std::size_t n) { for(std::size_t i=0; i<n; ++i) dst[i] = half_float::saturate_cast(src[i]); });
+		BULK_SATURATING_CONVERSION_TEST("saturate_cast<round_toward_zero>(float)", std::round_toward_zero, float, floats_,
+			[](const float *src, half *dst, std::size_t n) { for(std::size_t i=0; i<n; ++i) dst[i] = half_float::saturate_cast<std::round_toward_zero>(src[i]); });
+		BULK_SATURATING_CONVERSION_TEST("saturate_cast<round_toward_infinity>(double)", std::round_toward_infinity, double, doubles_,
+			[](const double *src, half *dst, std::size_t n) { for(std::size_t i=0; i<n; ++i) dst[i] = half_float::saturate_cast<std::round_toward_infinity>(src[i]); });
+		BULK_SATURATING_CONVERSION_TEST("saturate_cast<round_toward_neg_infinity>(double)", std::round_toward_neg_infinity, double, doubles_,
+			[](const double *src, half *dst, std::size_t n) { for(std::size_t i=0; i<n; ++i) dst[i] = half_float::saturate_cast<std::round_toward_neg_infinity>(src[i]); });
+		simple_test("saturate_cast(int)", []() { return h2b(half_float::saturate_cast(100000)) == 0x7BFF && h2b(half_float::saturate_cast(std::numeric_limits<int>::min())) == 0xFBFF &&
+			h2b(half_float::saturate_cast<std::round_toward_infinity>(-70000L)) == 0xFBFF && h2b(half_float::saturate_cast(1000u)) == h2b(half_cast<half>(1000u)); });
+		simple_test("convert(float) with statistics", [this]() { return bulk_stats_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(
+			[](const float *src, half *dst, std::size_t n, half_float::conversion_stats &stats) { half_float::convert(src, dst, n, stats); }); });
+		simple_test("convert<round_toward_infinity>(float) with statistics", [this]() { return bulk_stats_test<std::round_toward_infinity,HALF_ROUND_TIES_TO_EVEN>(
+			[](const float *src, half *dst, std::size_t n, half_float::conversion_stats &stats) { half_float::convert<std::round_toward_infinity>(src, dst, n, stats); }); });
+		simple_test("convert<round_to_nearest,false>(float) with statistics", [this]() { return bulk_stats_test<std::round_to_nearest,false>(
+			[](const float *src, half *dst, std::size_t n, half_float::conversion_stats &stats) { half_float::convert<std::round_to_nearest,false>(src, dst, n, stats); }); });
+		simple_test("convert(half) to double", [this]() { return bulk_conversion_test<double>([](const half *src, double *dst, std::size_t n) { half_float::convert(src, dst, n); }); });
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		simple_test("SSE2 half2double", [this]() { return bulk_conversion_test<double>([](const half *src, double *dst, std::size_t n) { half_float::detail::bulk::half2double_sse2(src, dst, n); }); });
+		simple_test("SSE2 conversion statistics", [this]() { return bulk_stats_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(
+			[](const float *src, half *dst, std::size_t n, half_float::conversion_stats &stats) { half_float::convert(src, dst, n);
+				std::size_t j = half_float::detail::bulk::stats_sse2(src, dst, n, stats); half_float::convert(src+j, dst+j, n-j, stats); }); });
+	#endif
+	#if HALF_ENABLE_F16C_INTRINSICS
+		if(half_float::detail::cpu_supports(half_float::detail::cpu_f16c))
+		{
+			simple_test("F16C conversion statistics", [this]() { return bulk_stats_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(
+				[](const float *src, half *dst, std::size_t n, half_float::conversion_stats &stats) { half_float::convert(src, dst, n);
+					std::size_t j = half_float::detail::bulk::stats_f16c(src, dst, n, stats); half_float::convert(src+j, dst+j, n-j, stats); }); });
+			simple_test("SSE2/F16C conversion statistics", [this]() -> bool { half_vector halfs(floats_.size()); half_float::conversion_stats a, b;
+				std::size_t n = floats_.size() & ~static_cast<std::size_t>(7); half_float::convert(floats_.data(), halfs.data(), n);
+				if(half_float::detail::bulk::stats_sse2(floats_.data(), halfs.data(), n, a) != n || half_float::detail::bulk::stats_f16c(floats_.data(), halfs.data(), n, b) != n) return false;
+				return a.overflow == b.overflow && a.underflow == b.underflow && a.subnormal == b.subnormal && a.nan == b.nan && a.max_error == b.max_error; });
+		}
+	#endif
+
+		//test streaming bulk conversion
+		half_float::set_streaming_threshold(0);
+		BULK_CONVERSION_TEST("streaming convert(float)", static_cast<std::float_round_style>(HALF_ROUND_STYLE), half_float::convert);
+		BULK_DOUBLE_CONVERSION_TEST("streaming convert(double)", static_cast<std::float_round_style>(HALF_ROUND_STYLE), half_float::convert);
+		simple_test("streaming convert(half)", [this]() { return bulk_conversion_test<float>([](const half *src, float *dst, std::size_t n) { half_float::convert(src, dst, n); }); });
+		simple_test("streaming convert(half) to double", [this]() { return bulk_conversion_test<double>([](const half *src, double *dst, std::size_t n) { half_float::convert(src, dst, n); }); });
+		half_float::set_streaming_threshold(HALF_STREAMING_THRESHOLD);
+
+		//test parallel bulk conversion
+		half_float::set_parallel_threads(4);
+		BULK_CONVERSION_TEST("convert_parallel(float)", static_cast<std::float_round_style>(HALF_ROUND_STYLE), half_float::convert_parallel);
+		BULK_CONVERSION_TEST("convert_parallel<round_toward_zero>(float)", std::round_toward_zero, half_float::convert_parallel<std::round_toward_zero>);
+		simple_test("convert_parallel(float) first-touch", [this]() { return bulk_conversion_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(
+			floats_, [](const float *src, half *dst, std::size_t n) { half_float::convert_parallel(src, dst, n, true); }); });
+		BULK_DOUBLE_CONVERSION_TEST("convert_parallel(double)", static_cast<std::float_round_style>(HALF_ROUND_STYLE), half_float::convert_parallel);
+		simple_test("convert_parallel(half)", [this]() { return bulk_conversion_test<float>([](const half *src, float *dst, std::size_t n) { half_float::convert_parallel(src, dst, n); }); });
+		simple_test("convert_parallel(half) to double", [this]() { return bulk_conversion_test<double>([](const half *src, double *dst, std::size_t n) { half_float::convert_parallel(src, dst, n, true); }); });
+		simple_test("nested convert_parallel(float)", [this]() { return bulk_conversion_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(
+			floats_, [](const float *src, half *dst, std::size_t n) { half_float::detail::parallel_for(n, false, [=](std::size_t begin, std::size_t end) {
+				half_float::convert_parallel(src+begin, dst+begin, end-begin); }, n/8+1); }); });
+		simple_test("set_parallel_threads during convert_parallel(float)", [this]() -> bool { std::atomic<bool> done(false);
+			std::thread resize([&done]() { for(unsigned int i=0; !done; ++i) half_float::set_parallel_threads(i%4+1); });
+			bool passed = bulk_conversion_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(floats_, 
+				[](const float *src, half *dst, std::size_t n) { half_float::convert_parallel(src, dst, n); });
+			done = true; resize.join(); return passed; });
+		half_float::set_parallel_threads(0);
+
+		//test strided and indexed bulk conversion
+		simple_test("convert_strided(float)", [this]() { return bulk_conversion_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(floats_,
+			[](const float *src, half *dst, std::size_t n) { std::vector<float> in(3*n); half_vector out(2*n); for(std::size_t i=0; i<n; ++i) in[3*i] = src[i];
+			half_float::convert_strided(in.data(), 3, n ? &out.back() : nullptr, -2, n); for(std::size_t i=0; i<n; ++i) dst[i] = out[2*(n-i)-1]; }); });
+		simple_test("convert_strided<round_toward_zero>(float)", [this]() { return bulk_conversion_test<std::round_toward_zero,HALF_ROUND_TIES_TO_EVEN>(floats_,
+			[](const float *src, half *dst, std::size_t n) { std::vector<float> in(5*n); for(std::size_t i=0; i<n; ++i) in[5*i] = src[i];
+			half_float::convert_strided<std::round_toward_zero>(in.data(), 5, dst, 1, n); }); });
+		simple_test("convert_strided(half)", [this]() { return bulk_conversion_test<float>([](const half *src, float *dst, std::size_t n) {
+			std::vector<float> out(4*n); half_float::convert_strided(src, 1, out.data(), 4, n); for(std::size_t i=0; i<n; ++i) dst[i] = out[4*i]; }); });
+		simple_test("convert_gather(float)", [this]() { return bulk_conversion_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(floats_,
+			[](const float *src, half *dst, std::size_t n) { std::vector<std::size_t> index(n); for(std::size_t i=0; i<n; ++i) index[i] = n - i - 1;
+			half_vector out(n); half_float::convert_gather(src, index.data(), out.data(), n); for(std::size_t i=0; i<n; ++i) dst[i] = out[n-i-1]; }); });
+		simple_test("convert_gather(half)", [this]() { return bulk_conversion_test<float>([](const half *src, float *dst, std::size_t n) {
+			std::vector<std::size_t> index(n); for(std::size_t i=0; i<n; ++i) index[i] = (i*7919) % n;
+			std::vector<float> out(n); half_float::convert_gather(src, index.data(), out.data(), n); for(std::size_t i=0; i<n; ++i) dst[index[i]] = out[i]; }); });
+		simple_test("convert_scatter(float)", [this]() { return bulk_conversion_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(floats_,
+			[](const float *src, half *dst, std::size_t n) { std::vector<std::size_t> index(n); for(std::size_t i=0; i<n; ++i) index[i] = n - i - 1;
+			half_vector out(n); half_float::convert_scatter(src, out.data(), index.data(), n); for(std::size_t i=0; i<n; ++i) dst[i] = out[n-i-1]; }); });
+		simple_test("convert_scatter(half)", [this]() { return bulk_conversion_test<float>([](const half *src, float *dst, std::size_t n) {
+			std::vector<std::size_t> index(n); for(std::size_t i=0; i<n; ++i) index[i] = n - i - 1; half_float::convert_scatter(src, dst, index.data(), n);
+			std::reverse(dst, dst+n); }); });
+
+		//test interleaved bulk conversion
+		simple_test("convert_deinterleave", [this]() { bool passed = true; for(std::size_t channels : { 1, 2, 3, 4, 5, 7 }) {
+			passed &= bulk_conversion_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(floats_, [channels](const float *src, half *dst, std::size_t n) {
+				std::size_t m = n / channels; std::vector<half_vector> planes(channels, half_vector(m)); std::vector<half*> ptrs;
+				for(auto &plane : planes) ptrs.push_back(plane.data());
+				half_float::convert_deinterleave(src, ptrs.data(), channels, m); half_float::convert(src+m*channels, dst+m*channels, n-m*channels);
+				for(std::size_t i=0; i<m; ++i) for(std::size_t c=0; c<channels; ++c) dst[i*channels+c] = planes[c][i]; }); }
+			return passed; });
+		simple_test("convert_deinterleave<round_toward_infinity>", [this]() { return bulk_conversion_test<std::round_toward_infinity,HALF_ROUND_TIES_TO_EVEN>(floats_,
+			[](const float *src, half *dst, std::size_t n) { std::size_t m = n / 4; std::vector<half_vector> planes(4, half_vector(m));
+				half *ptrs[4] = { planes[0].data(), planes[1].data(), planes[2].data(), planes[3].data() };
+				half_float::convert_deinterleave<std::round_toward_infinity>(src, ptrs, 4, m); half_float::convert<std::round_toward_infinity>(src+m*4, dst+m*4, n-m*4);
+				for(std::size_t i=0; i<m; ++i) for(std::size_t c=0; c<4; ++c) dst[i*4+c] = planes[c][i]; }); });
+		simple_test("convert_interleave", [this]() { bool passed = true; for(std::size_t channels : { 1, 2, 3, 4, 5, 7 }) {
+			passed &= bulk_conversion_test<float>([channels](const half *src, float *dst, std::size_t n) {
+				std::size_t m = n / channels; std::vector<half_vector> planes(channels, half_vector(m)); std::vector<const half*> ptrs;
+				for(std::size_t i=0; i<m; ++i) for(std::size_t c=0; c<channels; ++c) planes[c][i] = src[i*channels+c];
+				for(auto &plane : planes) ptrs.push_back(plane.data());
+				half_float::convert_interleave(ptrs.data(), dst, channels, m); half_float::convert(src+m*channels, dst+m*channels, n-m*channels); }); }
+			return passed; });
+
+		//test stochastic rounding
+		simple_test("stochastic_cast", [this]() { half_float::stochastic_rng rng(42); for(float f : floats_) { half h = half_float::stochastic_cast(f, rng);
+			std::uint16_t lo = half_float::detail::float2half<std::round_toward_zero,true>(f); if(h2b(h) != lo && (h2b(h) != lo+1 || (lo&0x7C00) == 0x7C00 ||
+			half_cast<float>(b2h(lo)) == f || std::abs(f) < std::numeric_limits<float>::min())) return false; } return rng.counter == floats_.size(); });
+		simple_test("stochastic_cast distribution", []() { half_float::stochastic_rng rng(7); const unsigned int n = 1 << 18; unsigned int up[4] = { 0, 0, 0, 0 };
+			const float values[4] = { 1.0f+std::ldexp(1.0f, -12), -1000.0f-0.75f*0.5f, std::ldexp(0.375f, -24), 65520.0f };
+			for(unsigned int i=0; i<n; ++i) for(int j=0; j<4; ++j) up[j] += std::abs(half_cast<float>(half_float::stochastic_cast(values[j], rng))) > std::abs(values[j]);
+			return std::abs(up[0]/double(n)-0.25) < 0.01 && std::abs(up[1]/double(n)-0.75) < 0.01 && std::abs(up[2]/double(n)-0.375) < 0.01 && 
+				std::abs(up[3]/double(n)-0.5) < 0.01; });
+		simple_test("convert(float) with stochastic rounding", [this]() { half_vector ref(floats_.size()), halfs(floats_.size());
+			half_float::stochastic_rng rng(1234, 0xFFFFFFF0); for(std::size_t i=0; i<floats_.size(); ++i) ref[i] = half_float::stochastic_cast(floats_[i], rng);
+			rng.counter = 0xFFFFFFF0; half_float::convert(floats_.data(), halfs.data(), 17, rng); half_float::convert(floats_.data()+17, halfs.data()+17, floats_.size()-17, rng);
+			for(std::size_t i=0; i<floats_.size(); ++i) if(h2b(halfs[i]) != h2b(ref[i])) return false;
+			half_float::set_parallel_threads(3); rng.counter = 0xFFFFFFF0; half_float::convert_parallel(floats_.data(), halfs.data(), floats_.size(), rng);
+			half_float::set_parallel_threads(0); for(std::size_t i=0; i<floats_.size(); ++i) if(h2b(halfs[i]) != h2b(ref[i])) return false;
+			return rng.counter == 0xFFFFFFF0 + floats_.size(); });
+
+		//test in-place bulk conversion
+		simple_test("convert_inplace(float)", [this]() { return bulk_conversion_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),HALF_ROUND_TIES_TO_EVEN>(floats_,
+			[](const float *src, half *dst, std::size_t n) { std::vector<float> data(src, src+n); half *out = half_float::convert_inplace(data.data(), n);
+			std::copy(out, out+n, dst); }); });
+		simple_test("convert_inplace<round_toward_neg_infinity>(float)", [this]() { return bulk_conversion_test<std::round_toward_neg_infinity,HALF_ROUND_TIES_TO_EVEN>(floats_,
+			[](const float *src, half *dst, std::size_t n) { std::vector<float> data(src, src+n); half *out = half_float::convert_inplace<std::round_toward_neg_infinity>(data.data(), n);
+			std::copy(out, out+n, dst); }); });
+		simple_test("convert_inplace(half)", [this]() { return bulk_conversion_test<float>([](const half *src, float *dst, std::size_t n) {
+			std::vector<float> data(n); std::memcpy(data.data(), src, n*sizeof(half)); float *out = half_float::convert_inplace(reinterpret_cast<half*>(data.data()), n);
+			std::copy(out, out+n, dst); }); });
+
+		//test long double conversion
+		LONG_DOUBLE_CONVERSION_TEST("half_cast<round_indeterminate>(long double)", std::round_indeterminate);
+		LONG_DOUBLE_CONVERSION_TEST("half_cast<round_toward_zero>(long double)", std::round_toward_zero);
+		LONG_DOUBLE_CONVERSION_TEST("half_cast<round_to_nearest>(long double)", std::round_to_nearest);
+		LONG_DOUBLE_CONVERSION_TEST("half_cast<round_toward_infinity>(long double)", std::round_toward_infinity);
+		LONG_DOUBLE_CONVERSION_TEST("half_cast<round_toward_neg_infinity>(long double)", std::round_toward_neg_infinity);
+		simple_test("half_cast<long double>", [this]() { for(std::uint32_t u=0; u<0x10000; ++u) { half h = b2h(u); long double ld = half_cast<long double>(h);
+			if(!comp(half_cast<half>(ld), h) || (!isnan(h) && ld != static_cast<long double>(half_cast<double>(h)))) return false; } return true; });
+
 		//test casting to int
 	#if HALF_ENABLE_CPP11_CMATH
 		unary_test("half_cast<int>", [](half arg) -> bool { return !isfinite(arg) || half_cast<int>(arg) == static_cast<int>(nearbyint(arg)); });
@@ -414,6 +703,305 @@ public:
 		int_test("half_cast<round_toward_neg_infinity>(int)", [](int i) -> bool { 
 			return comp(half_cast<half,std::round_toward_neg_infinity>(i), half_cast<half,std::round_toward_neg_infinity>(static_cast<float>(i))); });
 
+		simple_test("half_cast<>(integer limits)", []() { return comp(half_cast<half>(static_cast<signed char>(-128)), half_cast<half>(-128.0f)) &&
+			comp(half_cast<half>(static_cast<short>(-32768)), half_cast<half>(-32768.0f)) && comp(half_cast<half>(std::numeric_limits<int>::min()), -std::numeric_limits<half>::infinity()); });
+
+		//test integer bulk conversion
+		simple_test("convert_int(signed char)", [this]() { return int_bulk_conversion_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),false,signed char>(1.0f); });
+		simple_test("convert_int(unsigned char)", [this]() { return int_bulk_conversion_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),false,unsigned char>(1.0f); });
+		simple_test("convert_int(short)", [this]() { return int_bulk_conversion_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),false,short>(1.0f); });
+		simple_test("convert_int(unsigned short)", [this]() { return int_bulk_conversion_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),false,unsigned short>(1.0f); });
+		simple_test("convert_int(int)", [this]() { return int_bulk_conversion_test<static_cast<std::float_round_style>(HALF_ROUND_STYLE),false,int>(1.0f); });
+		simple_test("convert_int<round_to_nearest>(short)", [this]() { return int_bulk_conversion_test<std::round_to_nearest,false,short>(1.0f); });
+		simple_test("convert_int<round_toward_infinity>(int)", [this]() { return int_bulk_conversion_test<std::round_toward_infinity,false,int>(1.0f); });
+		simple_test("convert_int<round_toward_neg_infinity>(unsigned short)", [this]() { return int_bulk_conversion_test<std::round_toward_neg_infinity,false,unsigned short>(1.0f); });
+		simple_test("convert_int<round_to_nearest,true>(int)", [this]() { return int_bulk_conversion_test<std::round_to_nearest,true,int>(1.0f); });
+		simple_test("convert_int<round_toward_zero,true>(short) scaled", [this]() { return int_bulk_conversion_test<std::round_toward_zero,true,short>(1.0f/32768.0f); });
+		simple_test("convert_int<round_to_nearest>(unsigned char) scaled", [this]() { return int_bulk_conversion_test<std::round_to_nearest,false,unsigned char>(1.0f/255.0f); });
+
+		//test function tables
+		simple_test("function_table", []() { half_float::function_table table([](double x) { return std::tanh(x); });
+			for(std::uint32_t u=0; u<0x10000; ++u) if(!comp(table(b2h(u)), half_cast<half>(std::tanh(half_cast<double>(b2h(u)))))) return false;
+			return true; });
+		simple_test("function_table<round_toward_zero>", []() { half_float::function_table table([](double x) { return 1.0 / x; }, std::round_toward_zero);
+			half_vector halfs; for(std::uint32_t u=0; u<0x10000; ++u) halfs.push_back(b2h(u)); table(halfs.data(), halfs.data(), halfs.size());
+			for(std::uint32_t u=0; u<0x10000; ++u) if(!comp(halfs[u], half_cast<half,std::round_toward_zero>(1.0/half_cast<double>(b2h(u))))) return false;
+			return true; });
+		simple_test("tabulate", []() { half_vector halfs, out(0x10000); for(std::uint32_t u=0; u<0x10000; ++u) halfs.push_back(b2h(u));
+			half_float::tabulate<std::exp>(halfs.data(), out.data(), halfs.size());
+			for(std::uint32_t u=0; u<0x10000; ++u) if(!comp(out[u], half_cast<half>(std::exp(half_cast<double>(b2h(u))))) || 
+				!comp(half_float::tabulate<std::erf>(b2h(u)), half_cast<half>(std::erf(half_cast<double>(b2h(u)))))) return false;
+			return &half_float::tabulated<std::exp>() == &half_float::tabulated<std::exp>(); });
+
+		//test array mathematical functions
+		ARRAY_MATH_TEST(exp, [](double x) { return std::exp(x); });
+		ARRAY_MATH_TEST(exp2, [](double x) { return std::exp2(x); });
+		ARRAY_MATH_TEST(log, [](double x) { return std::log(x); });
+		ARRAY_MATH_TEST(log2, [](double x) { return std::log2(x); });
+		ARRAY_MATH_TEST(sqrt, [](double x) { return std::sqrt(x); });
+		ARRAY_MATH_TEST(sin, [](double x) { return std::sin(x); });
+		ARRAY_MATH_TEST(cos, [](double x) { return std::cos(x); });
+		ARRAY_MATH_TEST(tanh, [](double x) { return std::tanh(x); });
+		ARRAY_MATH_TEST(sigmoid, [](double x) { return 1.0 / (1.0+std::exp(-x)); });
+		ARRAY_MATH_ROUNDING_TEST(exp, [](double x) { return std::exp(x); });
+		ARRAY_MATH_ROUNDING_TEST(exp2, [](double x) { return std::exp2(x); });
+		ARRAY_MATH_ROUNDING_TEST(log, [](double x) { return std::log(x); });
+		ARRAY_MATH_ROUNDING_TEST(log2, [](double x) { return std::log2(x); });
+		ARRAY_MATH_ROUNDING_TEST(sqrt, [](double x) { return std::sqrt(x); });
+		ARRAY_MATH_ROUNDING_TEST(sin, [](double x) { return std::sin(x); });
+		ARRAY_MATH_ROUNDING_TEST(cos, [](double x) { return std::cos(x); });
+		ARRAY_MATH_ROUNDING_TEST(tanh, [](double x) { return std::tanh(x); });
+		ARRAY_MATH_ROUNDING_TEST(sigmoid, [](double x) { return 1.0 / (1.0+std::exp(-x)); });
+
+		//test array sign and comparison functions
+		simple_test("fabs, negate, copysign arrays", []() -> bool { half_vector x, y, a(0x10000), b(0x10000), c(0x10000);
+			for(std::uint32_t u=0; u<0x10000; ++u) { x.push_back(b2h(u)); y.push_back(b2h((u*40503)&0xFFFF)); }
+			for(std::size_t n : { 0x10000, 0xFFFB, 7, 0 }) { std::size_t o = 0x10000 - n;
+				half_float::fabs(x.data()+o, a.data(), n); half_float::negate(x.data()+o, b.data(), n); half_float::copysign(x.data()+o, y.data(), c.data(), n);
+				for(std::size_t i=0; i<n; ++i) if(h2b(a[i]) != h2b(fabs(x[o+i])) || h2b(b[i]) != h2b(-x[o+i]) || h2b(c[i]) != h2b(copysign(x[o+i], y[i]))) return false; }
+			half_float::negate(x.data(), x.data(), x.size()); return h2b(x[0]) == 0x8000 && h2b(x[0xFFFF]) == 0x7FFF; });
+		simple_test("fmin, fmax arrays", []() -> bool { half_vector x, y, z, a(0x10000), b(0x10000);
+			for(std::uint32_t u=0; u<0x10000; ++u) { x.push_back(b2h(u)); y.push_back(b2h((u*40503)&0xFFFF)); z.push_back(b2h(u^0x8000)); }
+			for(const half_vector *v : { &y, &z }) for(std::size_t n : { 0x10000, 0xFFF3, 13 }) {
+				half_float::fmin(x.data()+1, v->data(), a.data(), n-1); half_float::fmax(x.data()+1, v->data(), b.data(), n-1);
+				for(std::size_t i=0; i+1<n; ++i) if(h2b(a[i]) != h2b(fmin(x[i+1], (*v)[i])) || h2b(b[i]) != h2b(fmax(x[i+1], (*v)[i]))) return false; }
+			for(std::uint32_t bits : { 0x0000, 0x8000, 0x3C00, 0xFC00, 0x7E00 }) { half h = b2h(bits);
+				half_float::fmin(x.data(), h, a.data(), x.size()); half_float::fmax(x.data(), h, b.data(), x.size());
+				for(std::size_t i=0; i<x.size(); ++i) if(h2b(a[i]) != h2b(fmin(x[i], h)) || h2b(b[i]) != h2b(fmax(x[i], h))) return false; }
+			return true; });
+		simple_test("clamp, relu arrays", []() -> bool { half_vector x, a(0x10000);
+			for(std::uint32_t u=0; u<0x10000; ++u) x.push_back(b2h(u));
+			for(auto range : { std::make_pair(b2h(0xBC00), b2h(0x4000)), std::make_pair(b2h(0x8000), b2h(0x0000)), std::make_pair(b2h(0xFC00), b2h(0x7C00)) }) {
+				half_float::clamp(x.data(), range.first, range.second, a.data(), x.size()); for(std::size_t i=0; i<x.size(); ++i)
+					if(h2b(a[i]) != h2b(isnan(x[i]) ? x[i] : (x[i] < range.first) ? range.first : (range.second < x[i]) ? range.second : x[i])) return false; }
+			half_float::relu(x.data(), a.data(), x.size()); for(std::size_t i=0; i<x.size(); ++i)
+				if(h2b(a[i]) != (isnan(x[i]) ? h2b(x[i]) : signbit(x[i]) ? 0 : h2b(x[i]))) return false;
+			return true; });
+
+		//test array expressions
+		simple_test("array expressions", []() -> bool { half_vector x, z, y(0x10000), w(0x10000); half a = b2h(0x3D00), b = b2h(0xC0F0);
+			for(std::uint32_t u=0; u<0x10000; ++u) { x.push_back(b2h(u)); z.push_back(b2h(0xFFFF-u)); }
+			half_float::const_half_span xs(x), zs(z); half_float::half_span ys(y), ws(w);
+			ys = a*xs + b*zs; for(std::uint32_t u=0; u<0x10000; ++u) if(!comp(y[u], half(a*x[u]+b*z[u]))) return false;
+			ys = -xs/zs + sqrt(abs(zs)) - 1.5f; for(std::uint32_t u=0; u<0x10000; ++u)
+				if(!comp(y[u], half_cast<half>(-half_cast<float>(x[u])/half_cast<float>(z[u])+std::sqrt(std::fabs(half_cast<float>(z[u])))-1.5f))) return false;
+			ws = xs; ws *= zs; ws += 2.0f; for(std::uint32_t u=0; u<0x10000; ++u) if(!comp(w[u], half(half(x[u]*z[u])+half(2.0f)))) return false;
+			ws = xs; ws = ws*ws - xs; for(std::uint32_t u=0; u<0x10000; ++u) if(!comp(w[u], half(x[u]*x[u]-x[u]))) return false;
+			ws = 0.0f; half_float::half_span(w.data(), 100) = xs + half_float::const_half_span(z.data(), 50);
+			for(std::uint32_t u=0; u<100; ++u) if(!comp(w[u], (u<50) ? half(x[u]+z[u]) : half(0.0f))) return false;
+			half_float::half_span vs(ws); vs = 0.25f; return h2b(w[0]) == 0x3400 && vs.data() == w.data(); });
+
+		//test linear algebra
+		simple_test("dot", []() -> bool { half_vector x, y; long exact = 0;
+			for(int i=0; i<1000; ++i) { x.push_back(half(static_cast<float>(i%7-3))); y.push_back(half(static_cast<float>(i%5-2))); }
+			for(std::size_t n=0; n<=x.size(); n+=(n<40) ? 1 : 97)
+			{
+				exact = 0; for(std::size_t i=0; i<n; ++i) exact += (static_cast<long>(i%7)-3) * (static_cast<long>(i%5)-2);
+				if(half_float::dot(x.data(), y.data(), n) != static_cast<float>(exact) || half_float::dot<double>(x.data(), y.data(), n) != static_cast<double>(exact))
+					return false;
+			}
+			half_vector z; double ref = 0.0; for(std::uint32_t u=0; u<0x7C00; u+=3) { z.push_back(b2h(u)); ref += half_cast<double>(b2h(u)) * half_cast<double>(b2h(u)); }
+			if(std::abs(half_float::dot<double>(z.data(), z.data(), z.size())-ref) > 1e-12*ref || std::abs(half_float::dot(z.data(), z.data(), z.size())-ref) > 1e-5*ref)
+				return false;
+			z[17] = b2h(0x7E00); return std::isnan(half_float::dot(z.data(), x.data(), x.size())) && std::isnan(half_float::dot<double>(x.data(), z.data(), x.size())); });
+		simple_test("axpy", []() -> bool { half_vector x, y, z; half a = b2h(0xBE00);
+			for(std::uint32_t u=0; u<0x10000; ++u) { x.push_back(b2h(u)); y.push_back(b2h(0xFFFF-u)); } z = y;
+			half_float::axpy(a, x.data(), y.data(), x.size()); for(std::uint32_t u=0; u<0x10000; ++u) if(!comp(y[u], half(a*x[u]+z[u]))) return false;
+			half_float::axpy(2.0f, x.data(), x.data(), x.size()); for(std::uint32_t u=0; u<0x10000; ++u) if(!comp(x[u], half(3.0f*b2h(u)))) return false; return true; });
+		simple_test("gemv", []() -> bool { const std::size_t m = 37, n = 53, lda = 60; half_vector a(m*lda, b2h(0x7E00)), x, y(m), z(m, b2h(0x7E00));
+			for(std::size_t i=0; i<m; ++i) for(std::size_t j=0; j<n; ++j) a[i*lda+j] = half(static_cast<float>(static_cast<int>((i*n+j)%9)-4));
+			for(std::size_t j=0; j<n; ++j) x.push_back(half(static_cast<float>(static_cast<int>(j%5)-2) * 0.25f));
+			for(std::size_t i=0; i<m; ++i) y[i] = half(static_cast<float>(i));
+			half_vector w(y); half_float::gemv(m, n, 0.5f, a.data(), lda, x.data(), 3.0f, y.data()); half_float::gemv<double>(m, n, 1.5f, a.data(), lda, x.data(), 0.0f, z.data());
+			for(std::size_t i=0; i<m; ++i)
+			{
+				double sum = 0.0; for(std::size_t j=0; j<n; ++j) sum += half_cast<double>(a[i*lda+j]) * half_cast<double>(x[j]);
+				if(!comp(y[i], half_cast<half>(0.5*sum+3.0*half_cast<double>(w[i]))) || !comp(z[i], half_cast<half>(1.5*sum))) return false;
+			}
+			return true; });
+		simple_test("gemv parallel", []() -> bool { const std::size_t m = 300, n = 3000; half_vector a(m*n), x(n), y(m), z(m);
+			for(std::size_t i=0; i<a.size(); ++i) a[i] = half(static_cast<float>(static_cast<int>((i*7919)%17)-8) * 0.125f);
+			for(std::size_t j=0; j<n; ++j) x[j] = half(static_cast<float>(static_cast<int>((j*104729)%13)-6) * 0.25f);
+			half_float::set_parallel_threads(4); half_float::gemv(m, n, 1.0f, a.data(), n, x.data(), 0.0f, y.data());
+			half_float::gemv<double>(m, n, 1.0f, a.data(), n, x.data(), 0.0f, z.data()); half_float::set_parallel_threads(0);
+			for(std::size_t i=0; i<m; ++i)
+				if(h2b(y[i]) != h2b(half_cast<half>(half_float::dot(a.data()+i*n, x.data(), n))) || h2b(z[i]) != h2b(half_cast<half>(half_float::dot<double>(a.data()+i*n, x.data(), n))))
+					return false;
+			return true; });
+		simple_test("gemm", []() -> bool { std::size_t shapes[][3] = { { 0, 5, 3 }, { 5, 0, 3 }, { 7, 9, 0 }, { 1, 1, 1 }, { 13, 37, 300 }, { 100, 70, 513 }, { 150, 90, 300 } };
+			for(auto &s : shapes)
+			{
+				std::size_t m = s[0], n = s[1], k = s[2], lda = k+3, ldb = n+5, ldc = n+1; half_vector a(m*lda+1), b(k*ldb+1), c(m*ldc+1), d, e;
+				for(std::size_t i=0; i<a.size(); ++i) a[i] = half(static_cast<float>(static_cast<int>((i*7919)%17)-8) * 0.125f);
+				for(std::size_t i=0; i<b.size(); ++i) b[i] = half(static_cast<float>(static_cast<int>((i*104729)%13)-6) * 0.25f);
+				for(std::size_t i=0; i<c.size(); ++i) c[i] = half(static_cast<float>(i%11));
+				d = c; e = c; std::fill(e.begin(), e.end(), b2h(0x7E00));
+				half_float::gemm(m, n, k, 0.5f, a.data(), lda, b.data(), ldb, 2.0f, d.data(), ldc); half_float::gemm(m, n, k, 1.0f, a.data(), lda, b.data(), ldb, 0.0f, e.data(), ldc);
+				for(std::size_t i=0; i<m; ++i) for(std::size_t j=0; j<n; ++j)
+				{
+					double sum = 0.0; for(std::size_t p=0; p<k; ++p) sum += half_cast<double>(a[i*lda+p]) * half_cast<double>(b[p*ldb+j]);
+					if(!comp(d[i*ldc+j], half_cast<half>(0.5*sum+2.0*half_cast<double>(c[i*ldc+j]))) || !comp(e[i*ldc+j], half_cast<half>(sum))) return false;
+				}
+				if(!std::equal(c.begin()+m*ldc, c.end(), d.begin()+m*ldc, comp)) return false;
+			}
+			std::size_t m = 61, n = 83, k = 700; half_vector a(m*k), b(k*n), c(m*n), d(m*n);
+			for(std::size_t i=0; i<a.size(); ++i) a[i] = half(std::sin(static_cast<float>(i)));
+			for(std::size_t i=0; i<b.size(); ++i) b[i] = half(std::cos(static_cast<float>(i)));
+			half_float::detail::gemm_blocking<half_float::detail::gemm_kernel,std::round_to_nearest,true>(m, n, k, 1.0f, a.data(), k, b.data(), n, 0.0f, c.data(), n).run();
+			half_float::gemm(m, n, k, 1.0f, a.data(), k, b.data(), n, 0.0f, d.data(), n); if(!std::equal(c.begin(), c.end(), d.begin(), comp)) return false;
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			half_float::detail::gemm_blocking<half_float::detail::gemm_kernel_sse2,std::round_to_nearest,true>(m, n, k, 1.0f, a.data(), k, b.data(), n, 0.0f, d.data(), n).run();
+			if(!std::equal(c.begin(), c.end(), d.begin(), comp)) return false;
+		#endif
+			return true; });
+
+		//test reductions
+		simple_test("sum, mean, variance, nrm2", []() -> bool { half_vector x; double sum = 0.0, sqr = 0.0, var = 0.0;
+			for(std::uint32_t u=0; u<0x7C00; ++u) { x.push_back(b2h(u)); sum += half_cast<double>(b2h(u)); sqr += half_cast<double>(b2h(u)) * half_cast<double>(b2h(u)); }
+			for(std::size_t i=0; i<x.size(); ++i) var += (half_cast<double>(x[i])-sum/x.size()) * (half_cast<double>(x[i])-sum/x.size());
+			if(std::abs(half_float::sum(x.data(), x.size())-sum) > 1e-7*sum || std::abs(half_float::mean(x.data(), x.size())-sum/x.size()) > 1e-6*sum/x.size() || 
+				std::abs(half_float::variance(x.data(), x.size())-var/x.size()) > 1e-5*var/x.size() || std::abs(half_float::nrm2(x.data(), x.size())-std::sqrt(sqr)) > 1e-7*std::sqrt(sqr))
+				return false;
+			for(std::uint32_t u=0x8000; u<0xFC00; ++u) x.push_back(b2h(u));
+			if(half_float::sum(x.data(), x.size()) != 0.0f || half_float::mean(x.data(), x.size()) != 0.0f || half_float::sum(x.data(), 0) != 0.0f || !std::isnan(half_float::mean(x.data(), 0)))
+				return false;
+			x.push_back(b2h(0x7C00)); if(!std::isinf(half_float::sum(x.data(), x.size())) || !std::isinf(half_float::nrm2(x.data(), x.size()))) return false;
+			x.push_back(b2h(0x7E00)); return std::isnan(half_float::sum(x.data(), x.size())) && std::isnan(half_float::variance(x.data(), x.size())); });
+		simple_test("minimum, maximum, argmin, argmax", []() -> bool { half_vector x;
+			for(std::uint32_t u=0; u<0x10000; ++u) x.push_back(b2h((u*40503)&0xFFFF));
+			std::size_t imin = std::find_if(x.begin(), x.end(), [](half h) { return h2b(h) == 0xFC00; }) - x.begin(), imax = std::find_if(x.begin(), x.end(), [](half h) { return h2b(h) == 0x7C00; }) - x.begin();
+			if(h2b(half_float::minimum(x.data(), x.size())) != 0xFC00 || h2b(half_float::maximum(x.data(), x.size())) != 0x7C00 || 
+				half_float::argmin(x.data(), x.size()) != imin || half_float::argmax(x.data(), x.size()) != imax)
+				return false;
+			for(std::size_t n=1; n<40; ++n)
+			{
+				half_vector y(n, b2h(0x7E01)); y[n-1] = b2h(0x8000); y[n/2] = b2h(0x0000); y[n/3] = b2h(0x8000);
+				std::size_t lo = std::find_if(y.begin(), y.end(), [](half h) { return h2b(h) == 0x8000; }) - y.begin(), hi = std::find_if(y.begin(), y.end(), [](half h) { return h2b(h) == 0x0000; }) - y.begin();
+				if(hi == n) hi = lo;
+				if(h2b(half_float::minimum(y.data(), n)) != 0x8000 || h2b(half_float::maximum(y.data(), n)) != h2b(y[hi]) || 
+					half_float::argmin(y.data(), n) != lo || half_float::argmax(y.data(), n) != hi)
+					return false;
+				std::fill(y.begin(), y.end(), b2h(0xFE00));
+				if(!isnan(half_float::minimum(y.data(), n)) || !isnan(half_float::maximum(y.data(), n)) || half_float::argmin(y.data(), n) != n || half_float::argmax(y.data(), n) != n)
+					return false;
+			}
+			return half_float::argmax(x.data(), 0) == 0 && isnan(half_float::minimum(x.data(), 0)); });
+		simple_test("parallel reductions", []() -> bool { half_vector x; for(std::uint32_t i=0; i<1000000; ++i) x.push_back(b2h(((i*40503)&0x7BFF) ^ ((i&1)<<15)));
+			x[777777] = b2h(0x7BFF); half_float::set_parallel_threads(4);
+			bool result = half_float::sum_parallel(x.data(), x.size()) == half_float::sum(x.data(), x.size()) && half_float::mean_parallel(x.data(), x.size()) == half_float::mean(x.data(), x.size()) && 
+				half_float::variance_parallel(x.data(), x.size()) == half_float::variance(x.data(), x.size()) && half_float::nrm2_parallel(x.data(), x.size()) == half_float::nrm2(x.data(), x.size()) && 
+				h2b(half_float::minimum_parallel(x.data(), x.size())) == h2b(half_float::minimum(x.data(), x.size())) && 
+				h2b(half_float::maximum_parallel(x.data(), x.size())) == 0x7BFF && half_float::argmin_parallel(x.data(), x.size()) == half_float::argmin(x.data(), x.size()) && 
+				half_float::argmax_parallel(x.data(), x.size()) == half_float::argmax(x.data(), x.size());
+			half_float::set_parallel_threads(0); return result; });
+
+		//test exact accumulation
+		simple_test("exact_sum", []() -> bool { half_vector x; std::uint64_t sum = 0;
+			for(std::uint32_t u=0; u<0x6800; ++u) { x.push_back(b2h(u)); sum += static_cast<std::uint64_t>(std::ldexp(half_cast<double>(b2h(u)), 24)); }
+			for(std::uint32_t u=0; u<0x6800; u+=3) x.push_back(b2h(u|0x8000)), sum -= static_cast<std::uint64_t>(std::ldexp(half_cast<double>(b2h(u)), 24));
+			std::shuffle(x.begin(), x.end(), std::mt19937());
+			double value = std::ldexp(static_cast<double>(sum), -24);
+			if(half_float::exact_sum<double>(x.data(), x.size()) != value || half_float::exact_sum(x.data(), x.size()) != static_cast<float>(value) || 
+				h2b(half_float::exact_sum<half>(x.data(), x.size())) != h2b(half_cast<half>(value)))
+				return false;
+			half_float::exact_accumulator acc; for(std::size_t i=x.size(); i>0; --i) acc += x[i-1];
+			if(acc.value<double>() != value)
+				return false;
+			for(std::size_t i=0; i<x.size(); ++i) x[i] = -x[i];
+			acc.add(x.data(), x.size()); if(acc.value<double>() != 0.0 || std::signbit(acc.value<double>()))
+				return false;
+			half z[3] = { b2h(0x7C00), b2h(0x3C00), b2h(0xFC00) };
+			return std::isinf(half_float::exact_sum(z, 2)) && std::isinf(half_float::exact_sum(z+1, 2)) && half_float::exact_sum(z+1, 2) < 0.0f && 
+				std::isnan(half_float::exact_sum(z, 3)) && half_float::exact_sum(z, 0) == 0.0f; });
+		simple_test("exact_dot", []() -> bool { half_vector x, y, z; std::mt19937 gen; std::uniform_int_distribution<std::uint32_t> bits(0, 0xFFFF);
+			for(std::size_t i=0; i<100000; ++i) { x.push_back(b2h(bits(gen)&0xFBFF)); y.push_back(b2h(bits(gen)&0xFBFF)); z.push_back(-y.back()); }
+			half_float::exact_accumulator acc, ref; acc.add_products(x.data(), y.data(), x.size());
+			for(std::size_t i=x.size(); i>0; --i) ref.add_product(x[i-1], y[i-1]);
+			if(acc.value<double>() != ref.value<double>() || acc.value<double>() != half_float::exact_dot<double>(x.data(), y.data(), x.size()))
+				return false;
+			acc.add_products(x.data(), z.data(), x.size()); if(acc.value<double>() != 0.0)
+				return false;
+			half a[3] = { b2h(0x7BFF), b2h(0x0001), b2h(0xFBFF) }, b[3] = { b2h(0x7BFF), b2h(0x0001), b2h(0x7BFF) };
+			if(half_float::exact_dot<double>(a, b, 3) != std::ldexp(1.0, -48) || half_float::exact_dot(a, b, 3) != std::ldexp(1.0f, -48))
+				return false;
+			a[0] = b2h(0x7C00); b[0] = b2h(0x0000); if(!std::isnan(half_float::exact_dot(a, b, 3)))
+				return false;
+			b[0] = b2h(0x3C00); a[2] = b2h(0xFC00); return std::isinf(half_float::exact_dot(a, b, 2)) && std::isnan(half_float::exact_dot(a, b, 3)); });
+		simple_test("parallel exact reductions", []() -> bool { half_vector x, y; for(std::uint32_t i=0; i<1000000; ++i) x.push_back(b2h((i*40503)&0xFBFF)), y.push_back(b2h((i*7919)&0xFBFF));
+			half_float::set_parallel_threads(4);
+			bool result = half_float::exact_sum_parallel<double>(x.data(), x.size()) == half_float::exact_sum<double>(x.data(), x.size()) && 
+				half_float::exact_sum_parallel(x.data(), x.size()) == half_float::exact_sum(x.data(), x.size()) && 
+				half_float::exact_dot_parallel<double>(x.data(), y.data(), x.size()) == half_float::exact_dot<double>(x.data(), y.data(), x.size()) && 
+				half_float::exact_dot_parallel(x.data(), y.data(), x.size()) == half_float::exact_dot(x.data(), y.data(), x.size());
+			half_float::set_parallel_threads(0); return result; });
+
+		//test sorting
+		simple_test("sort", []() -> bool { half_vector x; for(std::uint32_t u=0; u<0x10000; ++u) x.push_back(b2h(u));
+			auto less = [](half a, half b) { return isnan(b) ? (!isnan(a) || (signbit(a) < signbit(b)) || (signbit(a) == signbit(b) && (h2b(a) < h2b(b)) != signbit(a))) : 
+				(!isnan(a) && (a < b || (a == b && signbit(a) && !signbit(b)))); };
+			for(std::size_t n : { 0x20000, 0x10000, 1000, 2, 1, 0 }) { half_vector y(n); for(std::size_t i=0; i<n; ++i) y[i] = x[(i*40503)&0xFFFF];
+				half_vector z(y); std::stable_sort(z.begin(), z.end(), less); half_float::sort(y.data(), n);
+				if(!std::equal(y.begin(), y.end(), z.begin(), [](half a, half b) { return h2b(a) == h2b(b); })) return false; }
+			return true; });
+		simple_test("key/value sort, argsort", []() -> bool { half_vector x; std::vector<std::size_t> values, indices(70000);
+			for(std::uint32_t i=0; i<70000; ++i) { x.push_back(b2h((i%5==0) ? (0x7E00|(i&0x8000)) : ((i*7919)&0xF8FF))); values.push_back(i); }
+			half_float::argsort(x.data(), indices.data(), x.size());
+			half_vector keys(x); half_float::sort(keys.data(), values.data(), keys.size());
+			if(values != indices) return false;
+			half_vector sorted(x); half_float::sort(sorted.data(), sorted.size());
+			for(std::size_t i=0; i<x.size(); ++i) if(h2b(keys[i]) != h2b(sorted[i]) || h2b(x[indices[i]]) != h2b(sorted[i]) || 
+				(i && h2b(sorted[i]) == h2b(sorted[i-1]) && indices[i] < indices[i-1])) return false;
+			return true; });
+		simple_test("partial_sort, top_k", []() -> bool { half_vector x; for(std::uint32_t i=0; i<50000; ++i) x.push_back(b2h(((i*40503)&0x7BFF) % 3000 | ((i&1)<<15)));
+			x[1234] = b2h(0x7E00); half_vector sorted(x); half_float::sort(sorted.data(), sorted.size());
+			std::vector<std::size_t> order(x.size()); half_float::argsort(x.data(), order.data(), x.size());
+			for(std::size_t k : { std::size_t(0), std::size_t(1), std::size_t(777), std::size_t(49999), std::size_t(50000), std::size_t(60000) }) {
+				half_vector y(x); half_float::partial_sort(y.data(), y.size(), k);
+				for(std::size_t i=0; i<std::min(k, y.size()); ++i) if(h2b(y[i]) != h2b(sorted[i])) return false;
+				half_vector rest; for(std::size_t i=std::min(k, y.size()); i<y.size(); ++i) rest.push_back(y[i]);
+				half_float::sort(rest.data(), rest.size()); for(std::size_t i=0; i<rest.size(); ++i) if(h2b(rest[i]) != h2b(sorted[k+i])) return false;
+				std::vector<std::size_t> top(k); half_float::top_k(x.data(), x.size(), k, top.data());
+				for(std::size_t i=0; i<std::min(k, x.size()); ++i) { if(h2b(x[top[i]]) != h2b(sorted[x.size()-1-i])) return false;
+					if(i && h2b(x[top[i]]) == h2b(x[top[i-1]]) && top[i] < top[i-1]) return false; } }
+			return true; });
+
+		//test histograms
+		simple_test("histogram", []() -> bool { half_vector x; for(std::uint32_t i=0; i<0x90000; ++i) x.push_back(b2h(((i*40503)&0x7BFF) % 5000 | ((i*7)&0x8000)));
+			x[10] = b2h(0x7E00); x[20] = b2h(0xFE01); x[30] = b2h(0x8000); x[40] = b2h(0x0000);
+			half_float::half_histogram hist(x.data(), x.size()), empty; half_vector sorted(x); half_float::sort(sorted.data(), sorted.size());
+			std::map<std::uint16_t,std::size_t> counts; for(half h : x) ++counts[h2b(h)];
+			for(auto &c : counts) if(hist.count(b2h(c.first)) != c.second) return false;
+			std::size_t n = x.size() - 2; if(hist.size() != x.size() || hist.nan_count() != 2) return false;
+			if(h2b(hist.minimum()) != h2b(sorted.front()) || h2b(hist.maximum()) != h2b(sorted[n-1])) return false;
+			std::uint16_t mode = 0; std::size_t most = 0; for(std::size_t i=0; i<n; ++i) { std::size_t c = counts[h2b(sorted[i])]; if(c > most) { mode = h2b(sorted[i]); most = c; } }
+			if(h2b(hist.mode()) != mode) return false;
+			for(double q : { 0.0, 1e-6, 0.25, 0.5, 0.999, 1.0 }) { std::size_t r = static_cast<std::size_t>(std::ceil(q*n));
+				if(h2b(hist.quantile(q)) != h2b(sorted[r ? (r-1) : 0])) return false; }
+			for(half h : { b2h(0x8000), b2h(0x3C00), b2h(0xBC00), b2h(0x7C00), b2h(0xFC00) }) { std::size_t c = 0;
+				for(std::size_t i=0; i<n; ++i) c += sorted[i] <= h;
+				if(hist.cdf(h) != static_cast<double>(c)/n) return false; }
+			if(!std::isnan(hist.cdf(b2h(0x7E00))) || !std::isnan(empty.cdf(b2h(0))) || !isnan(empty.quantile(0.5)) || 
+				!isnan(hist.quantile(std::numeric_limits<double>::quiet_NaN())) || !isnan(empty.mode()) || !isnan(empty.minimum()) || !isnan(empty.maximum())) return false;
+			half_float::half_histogram parallel, sum; half_float::set_parallel_threads(4); parallel.add_parallel(x.data(), x.size()); half_float::set_parallel_threads(0);
+			sum.add(x.data(), 1000) += x[1000]; for(std::size_t i=1001; i<x.size(); ++i) empty += x[i]; sum += empty;
+			for(std::uint32_t u=0; u<0x10000; ++u) if(parallel.count(b2h(u)) != hist.count(b2h(u)) || sum.count(b2h(u)) != hist.count(b2h(u))) return false;
+			return parallel.size() == x.size() && sum.size() == x.size(); });
+
+	#if HALF_ENABLE_FLOAT16
+		//test native half-precision type
+		unary_test("native_cast", [](half arg) -> bool { half_float::native_half value = half_float::native_cast(arg);
+			return h2b(half_float::native_cast(value)) == h2b(arg) && (isnan(arg) || static_cast<float>(value) == static_cast<float>(arg)); });
+		simple_test("native_cast arrays", []() -> bool { half_vector halfs; for(std::uint32_t u=0; u<0x10000; ++u) halfs.push_back(b2h(u));
+			const half_float::native_half *values = half_float::native_cast(static_cast<const half*>(halfs.data()));
+			if(static_cast<const void*>(values) != halfs.data() || half_float::native_cast(half_float::native_cast(halfs.data())) != halfs.data()) return false;
+			for(std::uint32_t u=0; u<0x10000; ++u) if(h2b(half_float::native_cast(values[u])) != u) return false;
+			return true; });
+		binary_test("native arithmetic", [](half a, half b) -> bool { half_float::native_half x = half_float::native_cast(a), y = half_float::native_cast(b);
+			half c = a, d = a, e = a, f = a; c += b; d -= b; e *= b; f /= b;
+			return comp(c, half_float::native_cast(static_cast<half_float::native_half>(x+y))) && comp(d, half_float::native_cast(static_cast<half_float::native_half>(x-y))) && 
+				comp(e, half_float::native_cast(static_cast<half_float::native_half>(x*y))) && comp(f, half_float::native_cast(static_cast<half_float::native_half>(x/y))); });
+	#endif
+
 		//test numeric limits
 		unary_test("numeric_limits::min", [](half arg) { return !isnormal(arg) || signbit(arg) || arg>=std::numeric_limits<half>::min(); });
 		unary_test("numeric_limits::lowest", [](half arg) { return !isfinite(arg) || arg>=std::numeric_limits<half>::lowest(); });
@@ -588,6 +1176,145 @@ private:
 		return passed;
 	}
 
+	template<std::float_round_style R,bool E,typename T,typename F> bool bulk_conversion_test(const std::vector<T> &values, F convert)
+	{
+		half_vector halfs(values.size());
+		for(std::size_t n : { std::size_t(0), std::size_t(1), std::size_t(7), std::size_t(9), std::size_t(17), values.size() })
+		{
+			convert(values.data(), halfs.data(), n);
+			for(std::size_t i=0; i<n; ++i)
+				if(h2b(halfs[i]) != ((E==HALF_ROUND_TIES_TO_EVEN) ? h2b(half_cast<half,R>(values[i])) : half_float::detail::float2half<R,E>(values[i])))
+					return false;
+		}
+		return true;
+	}
+
+	template<std::float_round_style R,typename T,typename F> bool bulk_saturating_conversion_test(const std::vector<T> &values, F convert)
+	{
+		half_vector halfs(values.size());
+		convert(values.data(), halfs.data(), values.size());
+		for(std::size_t i=0; i<values.size(); ++i)
+		{
+			half h = half_cast<half,R>(values[i]);
+			if(isinf(h) && std::abs(values[i]) <= std::numeric_limits<T>::max())
+				h = std::signbit(values[i]) ? -std::numeric_limits<half>::max() : std::numeric_limits<half>::max();
+			if(h2b(halfs[i]) != h2b(h))
+				return false;
+		}
+		return true;
+	}
+
+	template<std::float_round_style R,bool E,typename F> bool bulk_stats_test(F convert)
+	{
+		half_vector halfs(floats_.size());
+		half_float::conversion_stats ref;
+		for(float f : floats_)
+		{
+			half h = b2h(half_float::detail::float2half<R,E>(f));
+			if(std::isnan(f))
+				++ref.nan;
+			else if(isinf(h))
+				ref.overflow += std::isfinite(f);
+			else if(f != 0.0f)
+			{
+				ref.underflow += h == 0.0f;
+				ref.subnormal += h != 0.0f && !isnormal(h);
+				ref.max_error = std::max(ref.max_error, std::abs(half_cast<float>(h)-f)/std::abs(f));
+			}
+		}
+		half_float::conversion_stats stats;
+		convert(floats_.data(), halfs.data(), floats_.size(), stats);
+		convert(floats_.data(), halfs.data(), 17, stats);
+		convert(floats_.data()+17, halfs.data()+17, floats_.size()-17, stats);
+		for(std::size_t i=0; i<floats_.size(); ++i)
+			if(h2b(halfs[i]) != half_float::detail::float2half<R,E>(floats_[i]))
+				return false;
+		return stats.overflow == 2*ref.overflow && stats.underflow == 2*ref.underflow && stats.subnormal == 2*ref.subnormal && 
+			stats.nan == 2*ref.nan && stats.max_error == ref.max_error;
+	}
+
+	template<typename T,typename F> bool bulk_conversion_test(F convert)
+	{
+		half_vector halfs;
+		for(auto iterB=halfs_.begin(); iterB!=halfs_.end(); ++iterB)
+			halfs.insert(halfs.end(), iterB->second.begin(), iterB->second.end());
+		std::vector<T> values(halfs.size());
+		for(std::size_t n : { std::size_t(0), std::size_t(1), std::size_t(7), std::size_t(9), std::size_t(17), halfs.size() })
+		{
+			convert(halfs.data(), values.data(), n);
+			for(std::size_t i=0; i<n; ++i)
+			{
+				T value = half_cast<T>(halfs[i]);
+				if(std::memcmp(&values[i], &value, sizeof(T)))
+					return false;
+			}
+		}
+		return true;
+	}
+
+	template<std::float_round_style R,typename F,typename G> bool array_math_test(F kernel, G reference)
+	{
+		half_float::function_table table(reference, R);
+		half_vector halfs, results(0x10000);
+		for(std::uint32_t u=0; u<0x10000; ++u)
+			halfs.push_back(b2h(u));
+		for(std::size_t n : { std::size_t(0), std::size_t(1), std::size_t(7), std::size_t(9), std::size_t(17), halfs.size() })
+		{
+			kernel(halfs.data(), results.data(), n);
+			for(std::size_t i=0; i<n; ++i)
+				if(h2b(results[i]) != h2b(table(halfs[i])))
+					return false;
+		}
+		kernel(halfs.data(), halfs.data(), halfs.size());
+		return std::equal(halfs.begin(), halfs.end(), results.begin(), [](half a, half b) { return h2b(a) == h2b(b); });
+	}
+
+	template<std::float_round_style R> bool long_double_conversion_test()
+	{
+		for(double d : doubles_)
+		{
+			long double ld = d;
+			for(int i=0; i<2; ++i, ld+=ld*std::numeric_limits<long double>::epsilon())
+				if(!comp(half_cast<half,R>(ld), b2h(half_float::detail::float2half_impl<R,HALF_ROUND_TIES_TO_EVEN>(ld, half_float::detail::false_type()))))
+					return false;
+		}
+		return true;
+	}
+
+	template<std::float_round_style R,bool S,typename T> bool int_bulk_conversion_test(float scale)
+	{
+		std::vector<T> ints;
+		for(long i=std::max<long>(std::numeric_limits<T>::min(), -(1<<17)); i<=std::min<long>(std::numeric_limits<T>::max(), 1<<17); ++i)
+			ints.push_back(static_cast<T>(i));
+		ints.push_back(std::numeric_limits<T>::min());
+		ints.push_back(std::numeric_limits<T>::max());
+		half_vector halfs(ints.size());
+		half_float::convert_int<R,S>(ints.data(), halfs.data(), ints.size(), scale);
+		for(std::size_t i=0; i<ints.size(); ++i)
+		{
+			half h = (scale==1.0f) ? half_cast<half,R>(ints[i]) : half_cast<half,R>(static_cast<float>(ints[i])*scale);
+			if(S && isinf(h))
+				h = copysign(std::numeric_limits<half>::max(), h);
+			if(!comp(halfs[i], h))
+				return false;
+		}
+		if(scale != 1.0f)
+			return true;
+		halfs.clear();
+		for(std::uint32_t u=0; u<0x10000; ++u)
+			halfs.push_back(b2h(u));
+		ints.resize(halfs.size());
+		half_float::convert_int<R,S>(halfs.data(), ints.data(), halfs.size());
+		for(std::size_t i=0; i<halfs.size(); ++i)
+		{
+			long value = isnan(halfs[i]) ? (S ? 0L : signbit(halfs[i]) ? LONG_MIN : LONG_MAX) :
+				isinf(halfs[i]) ? (signbit(halfs[i]) ? LONG_MIN : LONG_MAX) : half_cast<long,R>(halfs[i]);
+			if(ints[i] != static_cast<T>(std::min<long>(std::max<long>(value, std::numeric_limits<T>::min()), std::numeric_limits<T>::max())))
+				return false;
+		}
+		return true;
+	}
+
 	template<typename F> bool int_test(const std::string &name, F test)
 	{
 		unsigned int count = 0, tests = (1<<17) + 1;
@@ -608,6 +1335,8 @@ private:
 
 	test_map halfs_;
 	class_map classes_;
+	std::vector<float> floats_;
+	std::vector<double> doubles_;
 	unsigned int tests_;
 	std::vector<std::string> failed_;
 	std::ostream &log_;